@@ -0,0 +1,86 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     llist_cfg.h
+* 
+* @brief    linked list library configuration header file
+* 
+* @version  0.2.1
+* 
+* @remark   configuration of the host (PC) build of the benchmarks and
+*           stress tests
+* 
+******************************************************************************/
+
+#ifndef _LLIST_CFG_H_
+#define _LLIST_CFG_H_
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+#include "mss_cfg.h"
+
+//*****************************************************************************
+// Global variable declarations 
+//*****************************************************************************
+
+
+//*****************************************************************************
+// Macros (defines) and data types 
+//*****************************************************************************
+
+/** MAX_NUM_OF_LLIST
+ *  maximum number of linked list which can be created with llist_create.
+ *  MSS modules embed their linked lists and do not need any of them, the
+ *  application might increase the number of linked list if it wish to
+ *  use llist_create. Linked lists can also be embedded by the application
+ *  with llist_head_t and llist_init without this table.
+ */
+#define MAX_NUM_OF_LLIST         (0)
+
+/** LLIST_DEBUG_MODE
+ *  activate the debug mode of linked list (llist) module if TRUE. Can be
+ *  turned off by setting it to FALSE in order to reduce memory usage.
+ */
+#define LLIST_DEBUG_MODE         (FALSE)
+
+/** LLIST_USE_COUNT
+ *  keep the number of objects of every linked list, so that llist_count
+ *  works in constant time. Costs two bytes per linked list.
+ */
+#define LLIST_USE_COUNT          (FALSE)
+
+//*****************************************************************************
+// External function declarations
+//*****************************************************************************
+
+
+#endif /* _LLIST_CFG_H_*/
@@ -0,0 +1,421 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     mss_cfg.h
+* 
+* @brief    mcu simple scheduler configuration header file
+* 
+* @version  0.2.1
+* 
+* @remark   configuration of the host (PC) build of the benchmarks and
+*           stress tests
+* 
+******************************************************************************/
+
+#ifndef _MSS_CFG_H_
+#define _MSS_CFG_H_
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+// declaration of the task function, every host program defines it
+void host_task(void* param);
+
+//*****************************************************************************
+// Global variable declarations 
+//*****************************************************************************
+
+
+//*****************************************************************************
+// Macros (defines) and data types 
+//*****************************************************************************
+
+/** MAX_NUM_OF_TASKS
+ *  maximum number of MSS tasks. This shall not exceed the number of bits which
+ *  the @ref mss_task_bits_t has.
+ */
+#define MSS_NUM_OF_TASKS                 (4)
+
+/** MSS_TASK_LIST
+ *  list of task function and parameter pointers of each MSS task. The task 
+ *  function pointer shall be a valid pointer to void (*) (void*) type function
+ *  while the parameter pointers can take a NULL pointer. On the host every
+ *  program provides host_task, which gets the task id as parameter.
+ */
+#define MSS_TASK_LIST                \
+        {                            \
+          {host_task, (void*)0},     \
+          {host_task, (void*)1},     \
+          {host_task, (void*)2},     \
+          {host_task, (void*)3},     \
+        }
+
+/** MSS_READY_TASK_BITS_INIT
+ *  initialization value of MSS task ready bits. Each bit set represent the 
+ *  task which is ready to be executed right at the beginning.
+ */
+#define MSS_READY_TASK_BITS_INIT         (0x0000)
+
+/** MSS_PREEMPTIVE_SCHEDULING
+ *  set to TRUE to activate preemptive scheduling, otherwise the scheduler
+ *  will work cooperatively.
+ */
+#define MSS_PREEMPTIVE_SCHEDULING        (FALSE)
+
+/** MSS_ISR_FAST_PATH
+ *  set to TRUE to enable mss_activate_task_from_isr() and
+ *  mss_event_set_from_isr() which can be called from ISRs without entering
+ *  critical section. The target HAL shall
+ *  provide MSS_ATOMIC_OR in mss_hal_int.h.
+ */
+#define MSS_ISR_FAST_PATH                (TRUE)
+
+/** MSS_TASK_USE_EVENT
+ *  set to TRUE to activate the MSS event flag module. If it is not used,
+ *  this option can be set as FALSE to save some memory space.
+ */
+#define MSS_TASK_USE_EVENT               (TRUE)
+
+/** MSS_TASK_USE_TIMER
+ *  set to TRUE to activate the MSS timer module. If it is not used,
+ *  this option can be set as FALSE to save some memory space.
+ */
+#define MSS_TASK_USE_TIMER               (TRUE)
+
+/** MSS_TASK_USE_TIMEOUT
+ *  set to TRUE to activate the blocking macros with timeout
+ *  (MSS_EVENT_WAIT_TIMEOUT, MSS_SEMA_WAIT_TIMEOUT, and
+ *  MSS_MQUE_WAIT_MSG_TIMEOUT). Needs MSS_TASK_USE_TIMER set to TRUE and
+ *  uses one internal timer block for every task.
+ */
+#define MSS_TASK_USE_TIMEOUT             (FALSE)
+
+/** MSS_TASK_USE_MQUE
+ *  set to TRUE to activate the MSS message queue module. If it is not used,
+ *  this option can be set as FALSE to save some memory space.
+ */
+#define MSS_TASK_USE_MQUE                (TRUE)
+
+#if (MSS_TASK_USE_MQUE == TRUE)
+/** MSS_MQUE_USE_CAPACITY
+ *  set to TRUE to count the messages in the message queues, which enables
+ *  bounded message queues (mss_mque_create_bounded, mss_mque_try_send, and
+ *  MSS_MQUE_WAIT_SPACE)
+ */
+#define MSS_MQUE_USE_CAPACITY            (TRUE)
+
+/** MSS_MQUE_NUM_OF_PRIO
+ *  number of message priorities of priority ordered message queues
+ *  (mss_mque_create_prio). If set to more than one, every message gets a
+ *  prio member which shall be included in the memory block size
+ */
+#define MSS_MQUE_NUM_OF_PRIO             (4)
+
+/** MSS_MQUE_USE_WORKQ
+ *  set to TRUE to enable work queues (mss_mque_create_workq), message queues
+ *  which distribute their messages to several consumer tasks
+ */
+#define MSS_MQUE_USE_WORKQ               (TRUE)
+
+/** MSS_MQUE_WORKQ_ROUND_ROBIN
+ *  set to TRUE to choose the idle consumer task of a work queue in round
+ *  robin order, otherwise the idle consumer task with the highest priority
+ *  is chosen
+ */
+#define MSS_MQUE_WORKQ_ROUND_ROBIN       (FALSE)
+#endif /* (MSS_TASK_USE_MQUE == TRUE) */
+
+/** MSS_TASK_USE_SEMA
+ *  set to TRUE to activate the MSS semaphore module. If it is not used,
+ *  this option can be set as FALSE to save some memory space.
+ */
+#define MSS_TASK_USE_SEMA                (TRUE)
+
+/** MSS_TASK_USE_MUTEX
+ *  set to TRUE to activate the MSS mutex module (with immediate priority
+ *  ceiling). If it is not used, this option can be set as FALSE to save some
+ *  memory space.
+ */
+#define MSS_TASK_USE_MUTEX               (TRUE)
+
+/** MSS_TASK_USE_RWLOCK
+ *  set to TRUE to activate the MSS reader-writer lock module. If it is not
+ *  used, this option can be set as FALSE to save some memory space.
+ */
+#define MSS_TASK_USE_RWLOCK              (TRUE)
+
+#if (MSS_TASK_USE_RWLOCK == TRUE)
+/** MSS_RWLOCK_WRITER_PREFERENCE
+ *  set to TRUE to block new readers as long as a writer task is waiting for
+ *  a reader-writer lock, otherwise waiting readers are preferred
+ */
+#define MSS_RWLOCK_WRITER_PREFERENCE     (FALSE)
+#endif /* (MSS_TASK_USE_RWLOCK == TRUE) */
+
+/** MSS_TASK_USE_MEM
+ *  set to TRUE to activate the MSS memory block. If it is not used,
+ *  this option can be set as FALSE to save some memory space.
+ */
+#define MSS_TASK_USE_MEM                 (TRUE)
+
+/** MSS_MEM_USE_STATS
+ *  set to TRUE to track the current usage, the high-water mark and the
+ *  failed allocations of every memory block list (see mss_mem_stats). Costs
+ *  eight bytes per memory block list.
+ */
+#define MSS_MEM_USE_STATS                (TRUE)
+
+/** MSS_TASK_USE_HEAP
+ *  set to TRUE to activate the MSS heap module, which manages several
+ *  memory block lists as size classes. Needs MSS_TASK_USE_MEM set to TRUE,
+ *  every size class uses one memory block list (include them in
+ *  MSS_MAX_NUM_OF_MEM).
+ */
+#define MSS_TASK_USE_HEAP                (FALSE)
+
+/** MSS_HEAP_NUM_OF_CLASS
+ *  maximum number of size classes of the MSS heap module
+ */
+#define MSS_HEAP_NUM_OF_CLASS            (4)
+
+/** MSS_HEAP_GRANULE
+ *  block sizes of the heap size classes are rounded up to a multiple of
+ *  this value. A smaller value allows finer size classes but needs a larger
+ *  size class lookup table (MSS_HEAP_MAX_BLOCK_SIZE / MSS_HEAP_GRANULE
+ *  bytes)
+ */
+#define MSS_HEAP_GRANULE                 (8)
+
+/** MSS_HEAP_MAX_BLOCK_SIZE
+ *  block size of the largest heap size class, shall be a multiple of
+ *  MSS_HEAP_GRANULE
+ */
+#define MSS_HEAP_MAX_BLOCK_SIZE          (64)
+
+/** MSS_TASK_USE_BUF
+ *  set to TRUE to activate the MSS reference counted buffer module. Needs
+ *  MSS_TASK_USE_MEM set to TRUE. If MSS_TASK_USE_MQUE is TRUE, the module
+ *  uses one memory block list (include it in MSS_MAX_NUM_OF_MEM) for the
+ *  messages of mss_buf_send.
+ */
+#define MSS_TASK_USE_BUF                 (TRUE)
+
+/** MSS_BUF_NUM_OF_MSG
+ *  number of messages for sending buffers to message queues, one message is
+ *  needed for every buffer reference waiting in a message queue
+ */
+#define MSS_BUF_NUM_OF_MSG               (4)
+
+/** MSS_TASK_USE_TOPIC
+ *  set to TRUE to activate the MSS publish/subscribe topic module. Needs
+ *  MSS_TASK_USE_MEM set to TRUE, every topic uses one memory block list
+ *  (include them in MSS_MAX_NUM_OF_MEM).
+ */
+#define MSS_TASK_USE_TOPIC               (TRUE)
+
+/** MSS_TASK_USE_STREAM
+ *  set to TRUE to activate the MSS byte stream module (single producer
+ *  single consumer byte buffer, e.g. for serial data from an ISR).
+ */
+#define MSS_TASK_USE_STREAM              (TRUE)
+
+/** MSS_MAX_NUM_OF_TIMER
+ *  maximum number of timer used in the MSS application. 
+ *  If @ref MSS_TASK_USE_TIMER is set as FALSE, this value will be 
+ *  automativally set to zero
+ */
+#if (MSS_TASK_USE_TIMER == TRUE)
+  #define MSS_MAX_NUM_OF_TIMER           (1)  
+#else
+  #define MSS_MAX_NUM_OF_TIMER           (0)
+#endif
+
+#if (MSS_TASK_USE_TIMER == TRUE)
+/** mss_timer_tick_t
+ *  mss timer tick data type - can be changed according to the application
+ *  however notice that a timer can be only started with maximum tick value
+ *  of half of the data type (e.g. 32767 for uint16_t, or
+ *  2147483647 for uint32_t)
+ */
+typedef uint16_t mss_timer_tick_t;
+#endif
+
+#if (MSS_TASK_USE_EVENT == TRUE)
+/** mss_event_t
+ *  mss event data type - can be changed if necessary
+ */
+typedef uint8_t  mss_event_t;
+
+/** MSS_EVENT_USE_COUNTER
+ *  set to TRUE to count every occurrence of each event bit instead of only
+ *  flagging it, so that repeated events are not collapsed. Every call of
+ *  mss_event_get() then consumes only one occurrence per event bit. Costs
+ *  one byte per event bit and two bytes for overflow statistic per task.
+ */
+#define MSS_EVENT_USE_COUNTER            (FALSE)
+#endif
+
+/** MSS_MAX_NUM_OF_EVENT_GROUP
+ *  maximum number of event groups used in the MSS application. An event
+ *  group delivers an event to all of its subscriber tasks at once.
+ *  If @ref MSS_TASK_USE_EVENT is set as FALSE, this value will be
+ *  automativally set to zero
+ */
+#if (MSS_TASK_USE_EVENT == TRUE)
+  #define MSS_MAX_NUM_OF_EVENT_GROUP     (1)
+#else
+  #define MSS_MAX_NUM_OF_EVENT_GROUP     (0)
+#endif
+
+/** MSS_MAX_NUM_OF_MQUE
+ *  maximum number of message queues used in the MSS application. 
+ *  If @ref MSS_TASK_USE_MQUE is set as FALSE, this value will be 
+ *  automativally set to zero
+ */
+#if (MSS_TASK_USE_MQUE == TRUE)
+  #define MSS_MAX_NUM_OF_MQUE            (4)
+#else
+  #define MSS_MAX_NUM_OF_MQUE            (0)
+#endif
+
+/** MSS_MAX_NUM_OF_MQUE_RING
+ *  maximum number of ring buffer message queues (fixed size messages which
+ *  are copied into a buffer) used in the MSS application.
+ *  If @ref MSS_TASK_USE_MQUE is set as FALSE, this value will be 
+ *  automativally set to zero
+ */
+#if (MSS_TASK_USE_MQUE == TRUE)
+  #define MSS_MAX_NUM_OF_MQUE_RING       (1)
+#else
+  #define MSS_MAX_NUM_OF_MQUE_RING       (0)
+#endif
+
+/** MSS_MAX_NUM_OF_SEMA
+ *  maximum number of semaphores used in the MSS application. 
+ *  If @ref MSS_TASK_USE_SEMA is set as FALSE, this value will be 
+ *  automativally set to zero
+ */
+#if (MSS_TASK_USE_SEMA == TRUE)
+  #define MSS_MAX_NUM_OF_SEMA            (2)
+#else
+  #define MSS_MAX_NUM_OF_SEMA            (0)
+#endif
+
+/** MSS_MAX_NUM_OF_COND
+ *  maximum number of condition variables used in the MSS application.
+ *  Condition variables are part of the semaphore module, if
+ *  @ref MSS_TASK_USE_SEMA is set as FALSE, this value will be automatically
+ *  set to zero
+ */
+#if (MSS_TASK_USE_SEMA == TRUE)
+  #define MSS_MAX_NUM_OF_COND            (1)
+#else
+  #define MSS_MAX_NUM_OF_COND            (0)
+#endif
+
+/** MSS_MAX_NUM_OF_MUTEX
+ *  maximum number of mutexes used in the MSS application. 
+ *  If @ref MSS_TASK_USE_MUTEX is set as FALSE, this value will be 
+ *  automativally set to zero
+ */
+#if (MSS_TASK_USE_MUTEX == TRUE)
+  #define MSS_MAX_NUM_OF_MUTEX           (1)
+#else
+  #define MSS_MAX_NUM_OF_MUTEX           (0)
+#endif
+
+/** MSS_MAX_NUM_OF_RWLOCK
+ *  maximum number of reader-writer locks used in the MSS application. 
+ *  If @ref MSS_TASK_USE_RWLOCK is set as FALSE, this value will be 
+ *  automativally set to zero
+ */
+#if (MSS_TASK_USE_RWLOCK == TRUE)
+  #define MSS_MAX_NUM_OF_RWLOCK          (1)
+#else
+  #define MSS_MAX_NUM_OF_RWLOCK          (0)
+#endif
+
+/** MSS_MAX_NUM_OF_MEM
+ *  maximum number of memory blocks used in the MSS application. 
+ *  If @ref MSS_TASK_USE_MEM is set as FALSE, this value will be 
+ *  automativally set to zero
+ */
+#if (MSS_TASK_USE_MEM == TRUE)
+  #define MSS_MAX_NUM_OF_MEM             (6)
+#else
+  #define MSS_MAX_NUM_OF_MEM             (0)
+#endif
+
+/** MSS_MAX_NUM_OF_MEM_ISR
+ *  maximum number of ISR sides of memory block lists (mss_mem_isr_create),
+ *  one is needed for every ISR allocating memory blocks. 
+ *  If @ref MSS_TASK_USE_MEM is set as FALSE, this value will be 
+ *  automativally set to zero
+ */
+#if (MSS_TASK_USE_MEM == TRUE)
+  #define MSS_MAX_NUM_OF_MEM_ISR         (2)
+#else
+  #define MSS_MAX_NUM_OF_MEM_ISR         (0)
+#endif
+
+/** MSS_MAX_NUM_OF_TOPIC
+ *  maximum number of publish/subscribe topics used in the MSS application. 
+ *  If @ref MSS_TASK_USE_TOPIC is set as FALSE, this value will be 
+ *  automativally set to zero
+ */
+#if (MSS_TASK_USE_TOPIC == TRUE)
+  #define MSS_MAX_NUM_OF_TOPIC           (1)
+#else
+  #define MSS_MAX_NUM_OF_TOPIC           (0)
+#endif
+
+/** MSS_MAX_NUM_OF_STREAM
+ *  maximum number of byte streams used in the MSS application. 
+ *  If @ref MSS_TASK_USE_STREAM is set as FALSE, this value will be 
+ *  automativally set to zero
+ */
+#if (MSS_TASK_USE_STREAM == TRUE)
+  #define MSS_MAX_NUM_OF_STREAM          (1)
+#else
+  #define MSS_MAX_NUM_OF_STREAM          (0)
+#endif
+
+/** MSS_DEBUG_MODE
+ *  set to TRUE to activate MSS debug mode. If not used, can be set to FALSE
+ *  in order to save some memory space
+ */
+#define MSS_DEBUG_MODE                   (FALSE)
+
+//*****************************************************************************
+// External function declarations
+//*****************************************************************************
+
+#endif /* _MSS_CFG_H_*/
@@ -0,0 +1,418 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     llist_sort_bench.c
+* 
+* @brief    host benchmark of the sorting of the linked list library
+*
+* @version  0.2.1
+*
+* @author   Leo Hendrawan
+* 
+* @remark   measures llist_sort on lists of several lengths, once on an
+*           unsorted and once on an already sorted list, and building a
+*           sorted list with llist_insert_sorted. Before measuring, every
+*           length is checked to be sorted stable, with consistent first,
+*           last (and prev) pointers. Build with
+*           LLIST_ENABLE_DOUBLE_LINKED_LIST defined as TRUE to measure the
+*           double linked list.
+*           usage: llist_sort_bench [number of sorted objects]
+* 
+******************************************************************************/
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+#include "dev_types.h"
+#include "llist.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+//*****************************************************************************
+// Global variables 
+//*****************************************************************************
+
+//*****************************************************************************
+// Macros (defines), data types, static variables
+//*****************************************************************************
+
+// default number of sorted objects per measurement
+#define BENCH_DEFAULT_OBJECTS            (1000000UL)
+
+// number of list lengths and their number of objects
+#define BENCH_NUM_OF_LENGTHS             (3)
+#define BENCH_LENGTH_1                   (8)
+#define BENCH_LENGTH_2                   (64)
+#define BENCH_LENGTH_3                   (512)
+
+// linked list object
+typedef struct {
+  void *next;
+#if (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE)
+  void *prev;
+#endif /* (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE) */
+  uint16_t key;
+  uint16_t seq;
+} bench_obj_t;
+
+// objects of the linked list
+static bench_obj_t objs[BENCH_LENGTH_3];
+
+// state of the pseudo random number generator
+static uint32_t bench_rand_state = 1;
+
+//*****************************************************************************
+// Internal function declarations
+//*****************************************************************************
+
+static void bench_fill(llist_t hdl, uint16_t num_of_objs);
+static bool bench_check_list(llist_t hdl, uint16_t num_of_objs);
+static bool bench_check(uint16_t num_of_objs);
+static double bench_sort(uint16_t num_of_objs, unsigned long objects,
+                         bool sorted);
+static double bench_insert_sorted(uint16_t num_of_objs,
+                                  unsigned long objects);
+static int8_t bench_comp_key(void* obj1, void* obj2);
+static int8_t bench_comp_hash(void* obj1, void* obj2);
+static uint16_t bench_rand(void);
+static double bench_now_ns(void);
+
+//*****************************************************************************
+// External functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* main
+*
+* @brief      main function
+*
+* @param[in]  argc    number of arguments
+* @param[in]  argv    arguments, the optional first one is the number of
+*                     sorted objects per measurement
+*
+* @return     0 if every length passed the check, otherwise 1
+*
+******************************************************************************/
+int main(int argc, char* argv[])
+{
+  static const uint16_t lengths[BENCH_NUM_OF_LENGTHS] = {
+    BENCH_LENGTH_1, BENCH_LENGTH_2, BENCH_LENGTH_3};
+  unsigned long objects = BENCH_DEFAULT_OBJECTS;
+  uint8_t i;
+
+  if(argc > 1)
+  {
+    objects = strtoul(argv[1], NULL, 0);
+  }
+
+  for(i=0 ; i<BENCH_NUM_OF_LENGTHS ; i++)
+  {
+    if(bench_check(lengths[i]) == false)
+    {
+      printf("list of %u objects: check failed\n", lengths[i]);
+      return 1;
+    }
+
+    printf("list of %3u objects: %8.1f ns/sort unsorted, "
+           "%8.1f ns/sort sorted, %8.1f ns/list insert sorted\n",
+           lengths[i], bench_sort(lengths[i], objects, false),
+           bench_sort(lengths[i], objects, true),
+           bench_insert_sorted(lengths[i], objects));
+  }
+
+  return 0;
+}
+
+//*****************************************************************************
+// Internal functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* bench_fill
+*
+* @brief      fill a linked list with objects with random keys, a key appears
+*             several times in the list
+*
+* @param[in]  hdl           handle of the linked list
+* @param[in]  num_of_objs   number of objects
+*
+* @return     -
+*
+******************************************************************************/
+static void bench_fill(llist_t hdl, uint16_t num_of_objs)
+{
+  uint16_t i;
+
+  llist_init(hdl);
+  for(i=0 ; i<num_of_objs ; i++)
+  {
+    objs[i].key = bench_rand() % ((num_of_objs / 4) + 1);
+    objs[i].seq = i;
+    llist_add_last(hdl, &objs[i]);
+  }
+}
+
+/**************************************************************************//**
+*
+* bench_check_list
+*
+* @brief      check that a linked list holds all objects sorted by key, and
+*             objects with equal keys in the order of their seq number
+*
+* @param[in]  hdl           handle of the linked list
+* @param[in]  num_of_objs   number of objects
+*
+* @return     true if the linked list is sorted correctly
+*
+******************************************************************************/
+static bool bench_check_list(llist_t hdl, uint16_t num_of_objs)
+{
+  bench_obj_t *obj, *prev_obj = NULL;
+  uint16_t count = 0;
+
+  for(obj = hdl->first ; obj != NULL ; prev_obj = obj, obj = obj->next)
+  {
+  #if (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE)
+    if(obj->prev != prev_obj)
+    {
+      return false;
+    }
+  #endif /* (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE) */
+    if((prev_obj != NULL) &&
+       ((prev_obj->key > obj->key) ||
+        ((prev_obj->key == obj->key) && (prev_obj->seq > obj->seq))))
+    {
+      return false;
+    }
+    count++;
+  }
+
+  return ((count == num_of_objs) && (hdl->last == prev_obj));
+}
+
+/**************************************************************************//**
+*
+* bench_check
+*
+* @brief      check llist_sort and llist_insert_sorted on a list length
+*
+* @param[in]  num_of_objs   number of objects
+*
+* @return     true if both sorted the list correctly
+*
+******************************************************************************/
+static bool bench_check(uint16_t num_of_objs)
+{
+  llist_head_t head;
+  bool ret;
+  uint16_t i;
+
+  // sort an unsorted list, and sort it again when already sorted
+  bench_fill(&head, num_of_objs);
+  llist_sort(&head, bench_comp_key);
+  ret = bench_check_list(&head, num_of_objs);
+  llist_sort(&head, bench_comp_key);
+  ret = ret && bench_check_list(&head, num_of_objs);
+
+  // insert the objects in the order of their seq number
+  llist_init(&head);
+  for(i=0 ; i<num_of_objs ; i++)
+  {
+    llist_insert_sorted(&head, &objs[i], bench_comp_key);
+  }
+  ret = ret && bench_check_list(&head, num_of_objs);
+
+  return ret;
+}
+
+/**************************************************************************//**
+*
+* bench_sort
+*
+* @brief      measure llist_sort. For an unsorted list the list is sorted
+*             alternately by key and by a hash of the seq number, so that
+*             every sort starts from an unsorted order
+*
+* @param[in]  num_of_objs   number of objects
+* @param[in]  objects       number of sorted objects (rounded up to a
+*                           multiple of num_of_objs)
+* @param[in]  sorted        true to sort an already sorted list
+*
+* @return     time per sort in nanoseconds
+*
+******************************************************************************/
+static double bench_sort(uint16_t num_of_objs, unsigned long objects,
+                         bool sorted)
+{
+  llist_head_t head;
+  unsigned long n, sorts = 0;
+  double start, end;
+
+  bench_fill(&head, num_of_objs);
+  llist_sort(&head, bench_comp_key);
+
+  start = bench_now_ns();
+  for(n=0 ; n<objects ; n+=num_of_objs)
+  {
+    if(sorted == false)
+    {
+      llist_sort(&head, bench_comp_hash);
+    }
+    llist_sort(&head, bench_comp_key);
+    sorts++;
+  }
+  end = bench_now_ns();
+
+  return (sorted == false) ? ((end - start) / (2 * sorts)) :
+                             ((end - start) / sorts);
+}
+
+/**************************************************************************//**
+*
+* bench_insert_sorted
+*
+* @brief      measure building a sorted list with llist_insert_sorted
+*
+* @param[in]  num_of_objs   number of objects
+* @param[in]  objects       number of inserted objects (rounded up to a
+*                           multiple of num_of_objs)
+*
+* @return     time per list in nanoseconds
+*
+******************************************************************************/
+static double bench_insert_sorted(uint16_t num_of_objs,
+                                  unsigned long objects)
+{
+  llist_head_t head;
+  unsigned long n, lists = 0;
+  uint16_t i;
+  double start, end;
+
+  bench_fill(&head, num_of_objs);
+
+  start = bench_now_ns();
+  for(n=0 ; n<objects ; n+=num_of_objs)
+  {
+    llist_init(&head);
+    for(i=0 ; i<num_of_objs ; i++)
+    {
+      llist_insert_sorted(&head, &objs[i], bench_comp_key);
+    }
+    lists++;
+  }
+  end = bench_now_ns();
+
+  return (end - start) / lists;
+}
+
+/**************************************************************************//**
+*
+* bench_comp_key
+*
+* @brief      compare two objects by key
+*
+* @param[in]  obj1    first object
+* @param[in]  obj2    second object
+*
+* @return     minus, zero or plus if obj1 is less, equal or greater
+*
+******************************************************************************/
+static int8_t bench_comp_key(void* obj1, void* obj2)
+{
+  uint16_t key1 = ((bench_obj_t*)obj1)->key;
+  uint16_t key2 = ((bench_obj_t*)obj2)->key;
+
+  return (key1 < key2) ? -1 : ((key1 > key2) ? 1 : 0);
+}
+
+/**************************************************************************//**
+*
+* bench_comp_hash
+*
+* @brief      compare two objects by a hash of their seq number, which
+*             orders the objects pseudo randomly
+*
+* @param[in]  obj1    first object
+* @param[in]  obj2    second object
+*
+* @return     minus, zero or plus if obj1 is less, equal or greater
+*
+******************************************************************************/
+static int8_t bench_comp_hash(void* obj1, void* obj2)
+{
+  uint16_t hash1 = (uint16_t)(((bench_obj_t*)obj1)->seq * 40503U);
+  uint16_t hash2 = (uint16_t)(((bench_obj_t*)obj2)->seq * 40503U);
+
+  return (hash1 < hash2) ? -1 : ((hash1 > hash2) ? 1 : 0);
+}
+
+/**************************************************************************//**
+*
+* bench_rand
+*
+* @brief      deterministic pseudo random number generator, so that every
+*             run measures the same lists
+*
+* @param      -
+*
+* @return     pseudo random number
+*
+******************************************************************************/
+static uint16_t bench_rand(void)
+{
+  bench_rand_state = (bench_rand_state * 1103515245UL) + 12345UL;
+
+  return (uint16_t)(bench_rand_state >> 16);
+}
+
+/**************************************************************************//**
+*
+* bench_now_ns
+*
+* @brief      read the monotonic clock
+*
+* @param      -
+*
+* @return     current time in nanoseconds
+*
+******************************************************************************/
+static double bench_now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return (ts.tv_sec * 1e9) + ts.tv_nsec;
+}
@@ -0,0 +1,319 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     mss_mem_bench.c
+* 
+* @brief    host benchmark of the mss memory module
+*
+* @version  0.2.1
+*
+* @author   Leo Hendrawan
+* 
+* @remark   measures mss_mem_alloc/mss_mem_free pairs at several pool
+*           sizes, once with a steady half used pool and once allocating
+*           the whole pool before freeing it again. Before measuring, every
+*           pool is checked to hand out each block once and to return NULL
+*           when it is exhausted. With preemptive scheduling the task side
+*           enters a critical section, on the host a sigprocmask system
+*           call which dominates the measured time.
+*           usage: mss_mem_bench [number of alloc/free pairs]
+* 
+******************************************************************************/
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+#include "mss.h"
+
+#include <stdio.h>
+#include <time.h>
+
+//*****************************************************************************
+// Global variables 
+//*****************************************************************************
+
+//*****************************************************************************
+// Macros (defines), data types, static variables
+//*****************************************************************************
+
+// size of a memory block in bytes
+#define BENCH_BLOCK_SIZE                 (32)
+
+// default number of alloc/free pairs per measurement
+#define BENCH_DEFAULT_PAIRS              (1000000UL)
+
+// number of pools and their number of blocks
+#define BENCH_NUM_OF_POOLS               (3)
+#define BENCH_POOL_1_BLOCKS              (8)
+#define BENCH_POOL_2_BLOCKS              (64)
+#define BENCH_POOL_3_BLOCKS              (512)
+
+// memory areas of the pools
+MSS_MEM_POOL_DEFINE(pool_1, BENCH_BLOCK_SIZE, BENCH_POOL_1_BLOCKS, 1);
+MSS_MEM_POOL_DEFINE(pool_2, BENCH_BLOCK_SIZE, BENCH_POOL_2_BLOCKS, 1);
+MSS_MEM_POOL_DEFINE(pool_3, BENCH_BLOCK_SIZE, BENCH_POOL_3_BLOCKS, 1);
+
+// pointers of the allocated blocks
+static void* blocks[BENCH_POOL_3_BLOCKS];
+
+//*****************************************************************************
+// Internal function declarations
+//*****************************************************************************
+
+static bool bench_check_pool(mss_mem_t hdl, uint16_t num_of_blocks);
+static double bench_steady(mss_mem_t hdl, uint16_t num_of_blocks,
+                           unsigned long pairs);
+static double bench_burst(mss_mem_t hdl, uint16_t num_of_blocks,
+                          unsigned long pairs);
+static double bench_now_ns(void);
+
+//*****************************************************************************
+// External functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* main
+*
+* @brief      main function
+*
+* @param[in]  argc    number of arguments
+* @param[in]  argv    arguments, the optional first one is the number of
+*                     alloc/free pairs per measurement
+*
+* @return     0 if every pool passed the check, otherwise 1
+*
+******************************************************************************/
+int main(int argc, char* argv[])
+{
+  static uint8_t* const pool_buf[BENCH_NUM_OF_POOLS] = {
+    pool_1, pool_2, pool_3};
+  static const uint16_t pool_blocks[BENCH_NUM_OF_POOLS] = {
+    BENCH_POOL_1_BLOCKS, BENCH_POOL_2_BLOCKS, BENCH_POOL_3_BLOCKS};
+  unsigned long pairs = BENCH_DEFAULT_PAIRS;
+  mss_mem_t hdl;
+  uint8_t i;
+
+  if(argc > 1)
+  {
+    pairs = strtoul(argv[1], NULL, 0);
+  }
+
+  mss_init();
+
+  for(i=0 ; i<BENCH_NUM_OF_POOLS ; i++)
+  {
+    hdl = mss_mem_create_static(pool_buf[i], BENCH_BLOCK_SIZE,
+                                pool_blocks[i], 1);
+
+    if((hdl == MSS_MEM_INVALID_HDL) ||
+       (bench_check_pool(hdl, pool_blocks[i]) == false))
+    {
+      printf("pool of %u blocks: check failed\n", pool_blocks[i]);
+      return 1;
+    }
+
+    printf("pool of %3u blocks: %6.2f ns/pair steady, %6.2f ns/pair burst\n",
+           pool_blocks[i], bench_steady(hdl, pool_blocks[i], pairs),
+           bench_burst(hdl, pool_blocks[i], pairs));
+  }
+
+  return 0;
+}
+
+/**************************************************************************//**
+*
+* host_task
+*
+* @brief      the MSS tasks, not used by the benchmark
+*
+* @param[in]  param     task parameter input (unused)
+*
+* @return     -
+*
+******************************************************************************/
+void host_task(void* param)
+{
+  (void)param;
+}
+
+//*****************************************************************************
+// Internal functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* bench_check_pool
+*
+* @brief      allocate every block of a pool, check that the pool is
+*             exhausted afterwards and free all blocks again
+*
+* @param[in]  hdl             memory blocks handle
+* @param[in]  num_of_blocks   number of memory blocks of the pool
+*
+* @return     true if the pool works correctly
+*
+******************************************************************************/
+static bool bench_check_pool(mss_mem_t hdl, uint16_t num_of_blocks)
+{
+  bool ret = true;
+  uint16_t i, j;
+
+  for(i=0 ; i<num_of_blocks ; i++)
+  {
+    blocks[i] = mss_mem_alloc(hdl);
+    if((blocks[i] == NULL) || (mss_mem_check_block(hdl, blocks[i]) == false))
+    {
+      return false;
+    }
+
+    // every block is handed out only once
+    for(j=0 ; j<i ; j++)
+    {
+      if(blocks[j] == blocks[i])
+      {
+        ret = false;
+      }
+    }
+  }
+
+  // the exhausted pool returns NULL
+  if(mss_mem_alloc(hdl) != NULL)
+  {
+    ret = false;
+  }
+
+  for(i=0 ; i<num_of_blocks ; i++)
+  {
+    mss_mem_free(hdl, blocks[i]);
+  }
+
+  return ret;
+}
+
+/**************************************************************************//**
+*
+* bench_steady
+*
+* @brief      measure alloc/free pairs while half of the pool is in use
+*
+* @param[in]  hdl             memory blocks handle
+* @param[in]  num_of_blocks   number of memory blocks of the pool
+* @param[in]  pairs           number of alloc/free pairs
+*
+* @return     time per alloc/free pair in nanoseconds
+*
+******************************************************************************/
+static double bench_steady(mss_mem_t hdl, uint16_t num_of_blocks,
+                           unsigned long pairs)
+{
+  unsigned long n;
+  uint16_t i;
+  double start, end;
+
+  for(i=0 ; i<(num_of_blocks / 2) ; i++)
+  {
+    blocks[i] = mss_mem_alloc(hdl);
+  }
+
+  start = bench_now_ns();
+  for(n=0 ; n<pairs ; n++)
+  {
+    mss_mem_free(hdl, mss_mem_alloc(hdl));
+  }
+  end = bench_now_ns();
+
+  for(i=0 ; i<(num_of_blocks / 2) ; i++)
+  {
+    mss_mem_free(hdl, blocks[i]);
+  }
+
+  return (end - start) / pairs;
+}
+
+/**************************************************************************//**
+*
+* bench_burst
+*
+* @brief      measure alloc/free pairs allocating the whole pool before
+*             freeing it again
+*
+* @param[in]  hdl             memory blocks handle
+* @param[in]  num_of_blocks   number of memory blocks of the pool
+* @param[in]  pairs           number of alloc/free pairs (rounded up to a
+*                             multiple of num_of_blocks)
+*
+* @return     time per alloc/free pair in nanoseconds
+*
+******************************************************************************/
+static double bench_burst(mss_mem_t hdl, uint16_t num_of_blocks,
+                          unsigned long pairs)
+{
+  unsigned long n;
+  uint16_t i;
+  double start, end;
+
+  start = bench_now_ns();
+  for(n=0 ; n<pairs ; n+=num_of_blocks)
+  {
+    for(i=0 ; i<num_of_blocks ; i++)
+    {
+      blocks[i] = mss_mem_alloc(hdl);
+    }
+    for(i=0 ; i<num_of_blocks ; i++)
+    {
+      mss_mem_free(hdl, blocks[i]);
+    }
+  }
+  end = bench_now_ns();
+
+  return (end - start) / n;
+}
+
+/**************************************************************************//**
+*
+* bench_now_ns
+*
+* @brief      read the monotonic clock
+*
+* @param      -
+*
+* @return     current time in nanoseconds
+*
+******************************************************************************/
+static double bench_now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return (ts.tv_sec * 1e9) + ts.tv_nsec;
+}
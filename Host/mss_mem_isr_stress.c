@@ -0,0 +1,470 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     mss_mem_isr_stress.c
+* 
+* @brief    host stress test of the ISR sides of the mss memory module
+*
+* @version  0.2.1
+*
+* @author   Leo Hendrawan
+* 
+* @remark   two POSIX timers raise two different signals, whose handlers
+*           play two ISRs which can interrupt each other. Each ISR allocates
+*           frames from its own ISR side of a shared memory block list and
+*           passes them to the task, or frees them itself if the task is
+*           behind. At the same time the task allocates and frees blocks of
+*           the task side and frees the received frames, which hands them
+*           back to their ISR side. Nobody masks interrupts. Every block is
+*           filled with the pattern of its current owner, which is checked
+*           before the block is cleared and freed, and a new block has to be
+*           clear. At the end all blocks have to be back on their side.
+*           usage: mss_mem_isr_stress [number of task loops]
+* 
+******************************************************************************/
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+#include "mss.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+//*****************************************************************************
+// Global variables 
+//*****************************************************************************
+
+//*****************************************************************************
+// Macros (defines), data types, static variables
+//*****************************************************************************
+
+// size of a memory block in bytes
+#define STRESS_BLOCK_SIZE                (16)
+
+// number of memory blocks of the memory block list and of the ISR sides,
+// ISR A runs out of blocks and ISR B out of frame ring entries while the
+// task does not take the frames
+#define STRESS_NUM_OF_BLOCKS             (48)
+#define STRESS_ISR_A_BLOCKS              (6)
+#define STRESS_ISR_B_BLOCKS              (12)
+
+// number of task side blocks the task holds at most
+#define STRESS_TASK_HELD                 (8)
+
+// default number of task loops
+#define STRESS_DEFAULT_LOOPS             (2000000UL)
+
+// the task takes no frames in every second phase of this number of loops
+#define STRESS_PHASE_LOOPS               (0x10000UL)
+
+// timer periods of the two ISRs in nanoseconds
+#define STRESS_ISR_A_PERIOD_NS           (20000)
+#define STRESS_ISR_B_PERIOD_NS           (27000)
+
+// number of ISRs and length of their frame rings towards the task
+#define STRESS_NUM_OF_ISR                (2)
+#define STRESS_FRAME_RING_LEN            (8)
+
+/** stress_isr_t
+ *  state of one simulated ISR
+ */
+typedef struct {
+  /** ISR side of the memory block list */
+  mss_mem_isr_t side;
+  /** frames passed to the task, written by the ISR */
+  void* volatile frame[STRESS_FRAME_RING_LEN];
+  /** frame ring write index, written by the ISR only */
+  volatile uint16_t frame_wr;
+  /** frame ring read index, written by the task only */
+  volatile uint16_t frame_rd;
+  /** pattern byte of the frames */
+  uint8_t pattern;
+  /** number of allocated frames */
+  volatile unsigned long allocs;
+  /** number of failed allocations */
+  volatile unsigned long failed;
+  /** number of frames freed by the ISR itself */
+  volatile unsigned long own_frees;
+} stress_isr_t;
+
+// memory area and hand back rings
+MSS_MEM_POOL_DEFINE(stress_pool, STRESS_BLOCK_SIZE, STRESS_NUM_OF_BLOCKS, 1);
+MSS_MEM_ISR_RING_DEFINE(stress_ring_a, STRESS_ISR_A_BLOCKS);
+MSS_MEM_ISR_RING_DEFINE(stress_ring_b, STRESS_ISR_B_BLOCKS);
+
+// memory block list
+static mss_mem_t stress_mem;
+
+// simulated ISRs, index 0 runs on SIGALRM and index 1 on SIGUSR2
+static stress_isr_t stress_isr[STRESS_NUM_OF_ISR];
+
+// pattern of the task side blocks
+#define STRESS_TASK_PATTERN              (0x5A)
+
+// corrupted blocks found by any context
+static volatile sig_atomic_t stress_errors = 0;
+
+// current and maximum ISR nesting depth
+static volatile sig_atomic_t stress_depth = 0;
+static volatile sig_atomic_t stress_max_depth = 0;
+
+//*****************************************************************************
+// Internal function declarations
+//*****************************************************************************
+
+static void stress_isr_handler(int sig);
+static bool stress_check(const uint8_t* data, uint8_t pattern);
+static bool stress_start_timer(int sig, long period_ns, timer_t* timer);
+static uint16_t stress_count(mss_mem_isr_t side);
+
+//*****************************************************************************
+// External functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* main
+*
+* @brief      main function, plays the task
+*
+* @param[in]  argc    number of arguments
+* @param[in]  argv    arguments, the optional first one is the number of
+*                     task loops
+*
+* @return     0 if the stress test passed, otherwise 1
+*
+******************************************************************************/
+int main(int argc, char* argv[])
+{
+  static void* held[STRESS_TASK_HELD];
+  unsigned long loops = STRESS_DEFAULT_LOOPS;
+  unsigned long n, frames = 0;
+  uint16_t task_blocks = 0;
+  uint8_t* data;
+  stress_isr_t* isr;
+  timer_t timer[STRESS_NUM_OF_ISR];
+  uint8_t i;
+
+  if(argc > 1)
+  {
+    loops = strtoul(argv[1], NULL, 0);
+  }
+
+  mss_init();
+
+  stress_mem = mss_mem_create_static(stress_pool, STRESS_BLOCK_SIZE,
+                                     STRESS_NUM_OF_BLOCKS, 1);
+  stress_isr[0].side = mss_mem_isr_create_static(stress_ring_a, stress_mem,
+                                                 STRESS_ISR_A_BLOCKS);
+  stress_isr[1].side = mss_mem_isr_create_static(stress_ring_b, stress_mem,
+                                                 STRESS_ISR_B_BLOCKS);
+  stress_isr[0].pattern = 0xA1;
+  stress_isr[1].pattern = 0xB2;
+
+  if((stress_isr[0].side == MSS_MEM_ISR_INVALID_HDL) ||
+     (stress_isr[1].side == MSS_MEM_ISR_INVALID_HDL) ||
+     (stress_start_timer(SIGALRM, STRESS_ISR_A_PERIOD_NS, &timer[0]) ==
+      false) ||
+     (stress_start_timer(SIGUSR2, STRESS_ISR_B_PERIOD_NS, &timer[1]) ==
+      false))
+  {
+    printf("setup failed\n");
+    return 1;
+  }
+
+  for(n=0 ; n<loops ; n++)
+  {
+    // produce and consume task side blocks
+    if((n & 1) && (task_blocks < STRESS_TASK_HELD))
+    {
+      data = mss_mem_alloc(stress_mem);
+      if(data != NULL)
+      {
+        if(stress_check(data, 0) == false)
+        {
+          stress_errors++;
+        }
+        memset(data, STRESS_TASK_PATTERN, STRESS_BLOCK_SIZE);
+        held[task_blocks++] = data;
+      }
+    }
+    else if(task_blocks > 0)
+    {
+      data = held[--task_blocks];
+      if(stress_check(data, STRESS_TASK_PATTERN) == false)
+      {
+        stress_errors++;
+      }
+      memset(data, 0, STRESS_BLOCK_SIZE);
+      mss_mem_free(stress_mem, data);
+    }
+
+    // free the frames of the ISRs, which hands them back to their side
+    for(i=0 ; (i<STRESS_NUM_OF_ISR) && ((n & STRESS_PHASE_LOOPS) == 0) ; i++)
+    {
+      isr = &stress_isr[i];
+      if(isr->frame_rd != isr->frame_wr)
+      {
+        data = isr->frame[isr->frame_rd];
+        isr->frame_rd = (isr->frame_rd + 1) % STRESS_FRAME_RING_LEN;
+        if(stress_check(data, isr->pattern) == false)
+        {
+          stress_errors++;
+        }
+        memset(data, 0, STRESS_BLOCK_SIZE);
+        mss_mem_free(stress_mem, data);
+        frames++;
+      }
+    }
+  }
+
+  // stop the ISRs and free everything still held
+  timer_delete(timer[0]);
+  timer_delete(timer[1]);
+  while(task_blocks > 0)
+  {
+    mss_mem_free(stress_mem, held[--task_blocks]);
+  }
+  for(i=0 ; i<STRESS_NUM_OF_ISR ; i++)
+  {
+    isr = &stress_isr[i];
+    while(isr->frame_rd != isr->frame_wr)
+    {
+      mss_mem_free(stress_mem, isr->frame[isr->frame_rd]);
+      isr->frame_rd = (isr->frame_rd + 1) % STRESS_FRAME_RING_LEN;
+    }
+  }
+
+  printf("frames A %lu (%lu failed, %lu own frees), "
+         "B %lu (%lu failed, %lu own frees)\n",
+         stress_isr[0].allocs, stress_isr[0].failed, stress_isr[0].own_frees,
+         stress_isr[1].allocs, stress_isr[1].failed, stress_isr[1].own_frees);
+  printf("frames freed by the task %lu, max ISR nesting %d, errors %d\n",
+         frames, (int)stress_max_depth, (int)stress_errors);
+
+  // every block has to be back on its side
+  for(task_blocks=0 ; mss_mem_alloc(stress_mem) != NULL ; task_blocks++)
+  {
+  }
+  if((stress_errors != 0) ||
+     (task_blocks != (STRESS_NUM_OF_BLOCKS - STRESS_ISR_A_BLOCKS -
+                      STRESS_ISR_B_BLOCKS)) ||
+     (stress_count(stress_isr[0].side) != STRESS_ISR_A_BLOCKS) ||
+     (stress_count(stress_isr[1].side) != STRESS_ISR_B_BLOCKS))
+  {
+    printf("FAILED\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+/**************************************************************************//**
+*
+* host_task
+*
+* @brief      the MSS tasks, not used by the stress test
+*
+* @param[in]  param     task parameter input (unused)
+*
+* @return     -
+*
+******************************************************************************/
+void host_task(void* param)
+{
+  (void)param;
+}
+
+//*****************************************************************************
+// Internal functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* stress_isr_handler
+*
+* @brief      signal handler playing an ISR: allocate a frame from its ISR
+*             side and pass it to the task, or free it again if the task is
+*             behind. ISR A raises ISR B in the middle of its work to nest
+*             them for sure.
+*
+* @param[in]  sig     signal number
+*
+* @return     -
+*
+******************************************************************************/
+static void stress_isr_handler(int sig)
+{
+  stress_isr_t* isr = &stress_isr[(sig == SIGALRM) ? 0 : 1];
+  uint8_t* data;
+  uint16_t wr;
+
+  if(++stress_depth > stress_max_depth)
+  {
+    stress_max_depth = stress_depth;
+  }
+
+  data = mss_mem_isr_alloc(isr->side);
+  if(data == NULL)
+  {
+    isr->failed++;
+  }
+  else
+  {
+    isr->allocs++;
+    if(stress_check(data, 0) == false)
+    {
+      stress_errors++;
+    }
+    memset(data, isr->pattern, STRESS_BLOCK_SIZE);
+
+    if((sig == SIGALRM) && ((isr->allocs & 0x3F) == 0))
+    {
+      raise(SIGUSR2);
+    }
+
+    wr = isr->frame_wr;
+    if(((wr + 1) % STRESS_FRAME_RING_LEN) != isr->frame_rd)
+    {
+      isr->frame[wr] = data;
+      isr->frame_wr = (wr + 1) % STRESS_FRAME_RING_LEN;
+    }
+    else
+    {
+      if(stress_check(data, isr->pattern) == false)
+      {
+        stress_errors++;
+      }
+      memset(data, 0, STRESS_BLOCK_SIZE);
+      mss_mem_isr_free(isr->side, data);
+      isr->own_frees++;
+    }
+  }
+
+  stress_depth--;
+}
+
+/**************************************************************************//**
+*
+* stress_check
+*
+* @brief      check whether a block still holds the pattern of its owner
+*
+* @param[in]  data      pointer of the data of the memory block
+* @param[in]  pattern   pattern byte of the owner
+*
+* @return     true if the block is intact
+*
+******************************************************************************/
+static bool stress_check(const uint8_t* data, uint8_t pattern)
+{
+  uint8_t i;
+
+  for(i=0 ; i<STRESS_BLOCK_SIZE ; i++)
+  {
+    if(data[i] != pattern)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**************************************************************************//**
+*
+* stress_start_timer
+*
+* @brief      install the signal handler and start a periodic timer raising
+*             the signal. The handler does not block other signals, so the
+*             ISRs can interrupt each other.
+*
+* @param[in]  sig         signal number
+* @param[in]  period_ns   timer period in nanoseconds
+* @param[out] timer       buffer for storing the timer
+*
+* @return     true if the timer is running
+*
+******************************************************************************/
+static bool stress_start_timer(int sig, long period_ns, timer_t* timer)
+{
+  struct sigaction sa;
+  struct sigevent sev;
+  struct itimerspec its;
+
+  sa.sa_handler = stress_isr_handler;
+  sigemptyset(&sa.sa_mask);
+  sa.sa_flags = 0;
+  if(sigaction(sig, &sa, NULL) != 0)
+  {
+    return false;
+  }
+
+  memset(&sev, 0, sizeof(sev));
+  sev.sigev_notify = SIGEV_SIGNAL;
+  sev.sigev_signo = sig;
+  if(timer_create(CLOCK_MONOTONIC, &sev, timer) != 0)
+  {
+    return false;
+  }
+
+  its.it_value.tv_sec = 0;
+  its.it_value.tv_nsec = period_ns;
+  its.it_interval = its.it_value;
+
+  return (timer_settime(*timer, 0, &its, NULL) == 0);
+}
+
+/**************************************************************************//**
+*
+* stress_count
+*
+* @brief      count the free memory blocks of an ISR side by allocating all
+*             of them, only while the ISRs are stopped
+*
+* @param[in]  side    ISR side handle
+*
+* @return     number of free memory blocks
+*
+******************************************************************************/
+static uint16_t stress_count(mss_mem_isr_t side)
+{
+  uint16_t ret = 0;
+
+  while(mss_mem_isr_alloc(side) != NULL)
+  {
+    ret++;
+  }
+
+  return ret;
+}
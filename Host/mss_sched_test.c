@@ -0,0 +1,924 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     mss_sched_test.c
+* 
+* @brief    host behaviour test of the mss scheduler modules
+*
+* @version  0.2.1
+*
+* @author   Leo Hendrawan
+* 
+* @remark   every test drives the four MSS tasks of the host configuration
+*           by activating them and running the scheduler until no task is
+*           ready, and checks the results of the tasks afterwards. The
+*           semaphore, mutex, reader-writer lock and topic functions are
+*           only called by the tasks, main only uses the functions which
+*           can be called from an ISR.
+*           usage: mss_sched_test
+* 
+******************************************************************************/
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+#include "mss.h"
+#include "mss_int.h"
+
+#include <stdio.h>
+#include <string.h>
+
+//*****************************************************************************
+// Global variables 
+//*****************************************************************************
+
+//*****************************************************************************
+// Macros (defines), data types, static variables
+//*****************************************************************************
+
+// number of messages of the message queue tests
+#define TEST_NUM_OF_MSG                  (6)
+
+// size of the stream buffer in bytes and trigger level of the stream test
+#define TEST_STREAM_SIZE                 (8)
+#define TEST_STREAM_TRIGGER              (4)
+
+/** test_msg_t
+ *  message of the message queue tests
+ */
+typedef struct {
+  /** pointer variable for putting message into linked list */
+  void *next;
+  /** message priority */
+  uint8_t prio;
+  /** message number */
+  uint8_t id;
+} test_msg_t;
+
+/** test_t
+ *  test table item
+ */
+typedef struct {
+  /** name of the test */
+  const char* name;
+  /** test function */
+  bool (*test)(void);
+} test_t;
+
+// task function of the running test and the contexts of the tasks
+static void (*test_task)(uint8_t task_id);
+static mss_task_ctx_t task_ctx[MSS_NUM_OF_TASKS];
+
+// release flags and results written by the tasks
+static bool task_release[MSS_NUM_OF_TASKS];
+static bool task_done[MSS_NUM_OF_TASKS];
+static uint8_t task_count[MSS_NUM_OF_TASKS];
+static uint8_t holders, max_holders;
+static bool cond_ready;
+static uint8_t prio_locked, prio_unlocked;
+
+// messages and their order of reception
+static test_msg_t msgs[TEST_NUM_OF_MSG];
+static uint8_t msg_order[TEST_NUM_OF_MSG];
+static uint8_t num_of_read, num_of_dropped;
+
+// stream buffer and the bytes read by the reader task
+MSS_STREAM_BUF_DEFINE(stream_buf, TEST_STREAM_SIZE);
+static uint8_t stream_out[TEST_STREAM_SIZE * 2];
+static uint16_t stream_out_len;
+
+// objects used by the running test
+static mss_sema_t sema_hdl;
+static mss_cond_t cond_hdl;
+static mss_mutex_t mutex_hdl;
+static mss_rwlock_t rwlock_hdl;
+static mss_mque_t mque_hdl;
+static mss_topic_t topic_hdl;
+static mss_stream_t stream_hdl;
+static void* topic_data[MSS_NUM_OF_TASKS];
+
+//*****************************************************************************
+// Internal function declarations
+//*****************************************************************************
+
+static void test_start(void (*task)(uint8_t task_id));
+static void test_run(uint8_t task_id);
+static bool test_sema_post_all(void);
+static void sema_task(uint8_t task_id);
+static bool test_cond_broadcast(void);
+static void cond_task(uint8_t task_id);
+static bool test_mutex_ceiling(void);
+static void mutex_task(uint8_t task_id);
+static bool test_rwlock(void);
+static void rwlock_task(uint8_t task_id);
+static bool test_mque_drop_oldest(void);
+static bool test_mque_wait_space(void);
+static void mque_task(uint8_t task_id);
+static bool test_mque_workq(void);
+static void workq_task(uint8_t task_id);
+static bool test_topic(void);
+static void topic_task(uint8_t task_id);
+static bool test_stream(void);
+static void stream_task(uint8_t task_id);
+
+//*****************************************************************************
+// External functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* main
+*
+* @brief      main function
+*
+* @param      -
+*
+* @return     0 if every test passed, otherwise 1
+*
+******************************************************************************/
+int main(void)
+{
+  static const test_t tests[] = {
+    {"sema post_all",          test_sema_post_all},
+    {"cond broadcast",         test_cond_broadcast},
+    {"mutex ceiling",          test_mutex_ceiling},
+    {"rwlock",                 test_rwlock},
+    {"mque drop oldest",       test_mque_drop_oldest},
+    {"mque wait space",        test_mque_wait_space},
+    {"mque workq",             test_mque_workq},
+    {"topic",                  test_topic},
+    {"stream",                 test_stream},
+  };
+  int ret = 0;
+  uint8_t i;
+
+  mss_init();
+
+  for(i=0 ; i<(sizeof(tests) / sizeof(tests[0])) ; i++)
+  {
+    if(tests[i].test())
+    {
+      printf("%-20s ok\n", tests[i].name);
+    }
+    else
+    {
+      printf("%-20s FAILED\n", tests[i].name);
+      ret = 1;
+    }
+  }
+
+  return ret;
+}
+
+/**************************************************************************//**
+*
+* host_task
+*
+* @brief      the MSS tasks, which run the task function of the running test
+*
+* @param[in]  param     task parameter input (task id)
+*
+* @return     -
+*
+******************************************************************************/
+void host_task(void* param)
+{
+  test_task((uint8_t)(uintptr_t)param);
+}
+
+//*****************************************************************************
+// Internal functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* test_start
+*
+* @brief      start a new test with all tasks at the beginning of the given
+*             task function and cleared results
+*
+* @param[in]  task      task function of the test
+*
+* @return     -
+*
+******************************************************************************/
+static void test_start(void (*task)(uint8_t task_id))
+{
+  uint8_t i;
+
+  test_task = task;
+  for(i=0 ; i<MSS_NUM_OF_TASKS ; i++)
+  {
+    task_ctx[i] = MSS_TASK_CTX_STATE_INIT_VAL;
+    task_release[i] = false;
+    task_done[i] = false;
+    task_count[i] = 0;
+    topic_data[i] = NULL;
+  }
+  holders = max_holders = 0;
+  num_of_read = num_of_dropped = 0;
+  stream_out_len = 0;
+}
+
+/**************************************************************************//**
+*
+* test_run
+*
+* @brief      activate a task and run the scheduler until no task is ready
+*
+* @param[in]  task_id   task id of the task to be activated
+*
+* @return     -
+*
+******************************************************************************/
+static void test_run(uint8_t task_id)
+{
+  mss_activate_task(task_id);
+  mss_scheduler();
+}
+
+/**************************************************************************//**
+*
+* test_sema_post_all
+*
+* @brief      a binary semaphore released with mss_sema_post_all is taken
+*             by only one of the woken up tasks, the others wait again
+*
+* @param      -
+*
+* @return     true if the test passed
+*
+******************************************************************************/
+static bool test_sema_post_all(void)
+{
+  test_start(sema_task);
+  sema_hdl = mss_sema_create(1);
+
+  // task 0 holds the semaphore, task 1 and 2 wait for it
+  test_run(0);
+  mss_activate_task(1);
+  test_run(2);
+
+  // task 0 wakes up both waiting tasks, only task 1 gets the semaphore
+  task_release[0] = true;
+  test_run(0);
+  if((task_count[1] != 1) || (task_count[2] != 0))
+  {
+    return false;
+  }
+
+  // task 2 gets the semaphore after task 1
+  task_release[1] = true;
+  test_run(1);
+  task_release[2] = true;
+  test_run(2);
+
+  return (sema_hdl != MSS_SEMA_INVALID_HDL) && (task_count[2] == 1) &&
+         (holders == 0) && (max_holders == 1);
+}
+
+/**************************************************************************//**
+*
+* sema_task
+*
+* @brief      task of the semaphore test, holds the semaphore until it is
+*             released by the test. Task 0 releases it with
+*             mss_sema_post_all, the others with mss_sema_post
+*
+* @param[in]  task_id   task id
+*
+* @return     -
+*
+******************************************************************************/
+static void sema_task(uint8_t task_id)
+{
+  MSS_BEGIN(task_ctx[task_id]);
+
+  MSS_SEMA_WAIT(sema_hdl, task_ctx[task_id]);
+  task_count[task_id]++;
+  if(++holders > max_holders)
+  {
+    max_holders = holders;
+  }
+
+  while(!task_release[task_id])
+  {
+    MSS_RETURN(task_ctx[task_id]);
+  }
+
+  holders--;
+  if(task_id == 0)
+  {
+    mss_sema_post_all(sema_hdl);
+  }
+  else
+  {
+    mss_sema_post(sema_hdl);
+  }
+
+  MSS_FINISH();
+}
+
+/**************************************************************************//**
+*
+* test_cond_broadcast
+*
+* @brief      tasks waiting on a condition variable go on waiting after a
+*             signal while the condition is false, and all of them proceed
+*             after a broadcast with the condition true
+*
+* @param      -
+*
+* @return     true if the test passed
+*
+******************************************************************************/
+static bool test_cond_broadcast(void)
+{
+  bool ret;
+
+  test_start(cond_task);
+  cond_hdl = mss_cond_create();
+  cond_ready = false;
+
+  mss_activate_task(1);
+  mss_activate_task(2);
+  test_run(3);
+
+  // task 0 signals while the condition is false
+  test_run(0);
+  ret = !task_done[1] && !task_done[2] && !task_done[3];
+
+  // task 0 broadcasts with the condition true
+  cond_ready = true;
+  test_run(0);
+
+  return ret && (cond_hdl != MSS_COND_INVALID_HDL) &&
+         task_done[1] && task_done[2] && task_done[3];
+}
+
+/**************************************************************************//**
+*
+* cond_task
+*
+* @brief      task of the condition variable test. Task 0 signals or
+*             broadcasts the condition variable, the other tasks wait for
+*             the condition
+*
+* @param[in]  task_id   task id
+*
+* @return     -
+*
+******************************************************************************/
+static void cond_task(uint8_t task_id)
+{
+  MSS_BEGIN(task_ctx[task_id]);
+
+  if(task_id == 0)
+  {
+    while(1)
+    {
+      if(cond_ready)
+      {
+        mss_cond_broadcast(cond_hdl);
+      }
+      else
+      {
+        mss_cond_signal(cond_hdl);
+      }
+      MSS_RETURN(task_ctx[task_id]);
+    }
+  }
+
+  MSS_COND_WAIT(cond_hdl, cond_ready, task_ctx[task_id]);
+  task_done[task_id] = true;
+
+  MSS_FINISH();
+}
+
+/**************************************************************************//**
+*
+* test_mutex_ceiling
+*
+* @brief      the owner of a mutex runs with the ceiling priority until it
+*             unlocks the mutex (also recursively locked), then the mutex is
+*             handed over to the waiting task
+*
+* @param      -
+*
+* @return     true if the test passed
+*
+******************************************************************************/
+static bool test_mutex_ceiling(void)
+{
+  bool ret;
+
+  test_start(mutex_task);
+  mutex_hdl = mss_mutex_create(1);
+
+  // task 3 locks the mutex and keeps it, task 2 waits for it
+  test_run(3);
+  test_run(2);
+  ret = (prio_locked == 1) && !task_done[2];
+
+  // task 3 unlocks the mutex and gets back its own priority
+  task_release[3] = true;
+  test_run(3);
+
+  return ret && (mutex_hdl != MSS_MUTEX_INVALID_HDL) &&
+         (prio_unlocked == 3) && task_done[2] && task_done[3];
+}
+
+/**************************************************************************//**
+*
+* mutex_task
+*
+* @brief      task of the mutex test. Task 3 locks the mutex twice and keeps
+*             it until it is released by the test, task 2 only locks it
+*
+* @param[in]  task_id   task id
+*
+* @return     -
+*
+******************************************************************************/
+static void mutex_task(uint8_t task_id)
+{
+  MSS_BEGIN(task_ctx[task_id]);
+
+  MSS_MUTEX_LOCK(mutex_hdl, task_ctx[task_id]);
+
+  if(task_id == 3)
+  {
+    // lock recursively, the ceiling is kept until the last unlock
+    if(mss_mutex_lock(mutex_hdl))
+    {
+      mss_mutex_unlock(mutex_hdl);
+    }
+    prio_locked = mss_running_task_prio;
+
+    while(!task_release[task_id])
+    {
+      MSS_RETURN(task_ctx[task_id]);
+    }
+  }
+
+  mss_mutex_unlock(mutex_hdl);
+  if(task_id == 3)
+  {
+    prio_unlocked = mss_running_task_prio;
+  }
+  task_done[task_id] = true;
+
+  MSS_FINISH();
+}
+
+/**************************************************************************//**
+*
+* test_rwlock
+*
+* @brief      two readers hold a reader-writer lock at the same time, the
+*             writer gets it after the last reader has unlocked it
+*
+* @param      -
+*
+* @return     true if the test passed
+*
+******************************************************************************/
+static bool test_rwlock(void)
+{
+  bool ret;
+
+  test_start(rwlock_task);
+  rwlock_hdl = mss_rwlock_create();
+
+  // task 1 and 2 read, task 3 waits to write
+  mss_activate_task(1);
+  test_run(2);
+  test_run(3);
+  ret = (holders == 2) && !task_done[3];
+
+  task_release[1] = true;
+  test_run(1);
+  ret = ret && !task_done[3];
+
+  task_release[2] = true;
+  test_run(2);
+
+  return ret && (rwlock_hdl != MSS_RWLOCK_INVALID_HDL) && task_done[3] &&
+         (max_holders == 2);
+}
+
+/**************************************************************************//**
+*
+* rwlock_task
+*
+* @brief      task of the reader-writer lock test. Task 3 writes, the other
+*             tasks read and keep the lock until they are released by the
+*             test
+*
+* @param[in]  task_id   task id
+*
+* @return     -
+*
+******************************************************************************/
+static void rwlock_task(uint8_t task_id)
+{
+  MSS_BEGIN(task_ctx[task_id]);
+
+  if(task_id == 3)
+  {
+    MSS_RWLOCK_WR_WAIT(rwlock_hdl, task_ctx[task_id]);
+    task_done[task_id] = (holders == 0);
+    mss_rwlock_wr_unlock(rwlock_hdl);
+  }
+  else
+  {
+    MSS_RWLOCK_RD_WAIT(rwlock_hdl, task_ctx[task_id]);
+    if(++holders > max_holders)
+    {
+      max_holders = holders;
+    }
+
+    while(!task_release[task_id])
+    {
+      MSS_RETURN(task_ctx[task_id]);
+    }
+
+    holders--;
+    mss_rwlock_rd_unlock(rwlock_hdl);
+  }
+
+  MSS_FINISH();
+}
+
+/**************************************************************************//**
+*
+* test_mque_drop_oldest
+*
+* @brief      a full priority ordered bounded mque with MSS_MQUE_DROP_OLDEST
+*             drops the oldest message of the lowest priority, or the new
+*             message if its priority is lower than all queued messages
+*
+* @param      -
+*
+* @return     true if the test passed
+*
+******************************************************************************/
+static bool test_mque_drop_oldest(void)
+{
+  static const uint8_t prio[TEST_NUM_OF_MSG] = {0, 2, 2, 1, 3, 0};
+  static const uint8_t dropped[TEST_NUM_OF_MSG] = {0, 0, 0, 1, 4, 2};
+  test_msg_t* msg;
+  bool ret = true;
+  uint8_t i;
+
+  test_start(mque_task);
+  mque_hdl = mss_mque_create_prio_bounded(0, 3, MSS_MQUE_DROP_OLDEST);
+
+  for(i=0 ; i<TEST_NUM_OF_MSG ; i++)
+  {
+    msgs[i].prio = prio[i];
+    msgs[i].id = i;
+    msg = (test_msg_t*)mss_mque_try_send(mque_hdl, (mss_mque_msg_t*)&msgs[i]);
+    if(i < 3)
+    {
+      ret = ret && (msg == NULL);
+    }
+    else
+    {
+      ret = ret && (msg != NULL) && (msg->id == dropped[i]);
+    }
+  }
+
+  // the owner task reads the rest in order of priority
+  mss_scheduler();
+
+  return ret && (mque_hdl != MSS_MQUE_INVALID_HDL) && (num_of_read == 3) &&
+         (msg_order[0] == 0) && (msg_order[1] == 5) && (msg_order[2] == 3);
+}
+
+/**************************************************************************//**
+*
+* test_mque_wait_space
+*
+* @brief      a task sending to a full bounded mque waits until the owner
+*             task has read a message, so that no message is dropped
+*
+* @param      -
+*
+* @return     true if the test passed
+*
+******************************************************************************/
+static bool test_mque_wait_space(void)
+{
+  bool ret = true;
+  uint8_t i;
+
+  test_start(mque_task);
+  mque_hdl = mss_mque_create_bounded(0, 2, MSS_MQUE_DROP_NEWEST);
+
+  // task 1 sends all messages, task 0 reads them
+  test_run(1);
+
+  for(i=0 ; i<TEST_NUM_OF_MSG ; i++)
+  {
+    ret = ret && (msg_order[i] == i);
+  }
+
+  return ret && (mque_hdl != MSS_MQUE_INVALID_HDL) && task_done[1] &&
+         (num_of_read == TEST_NUM_OF_MSG) && (num_of_dropped == 0) &&
+         (max_holders <= 2) && (task_count[1] > 0);
+}
+
+/**************************************************************************//**
+*
+* mque_task
+*
+* @brief      task of the message queue tests. Task 0 is the owner task
+*             which reads all messages, task 1 sends the messages and waits
+*             for space in the mque before sending each message
+*
+* @param[in]  task_id   task id
+*
+* @return     -
+*
+******************************************************************************/
+static void mque_task(uint8_t task_id)
+{
+  static uint8_t i;
+  test_msg_t* msg;
+  uint8_t num_of_msg = 0;
+
+  MSS_BEGIN(task_ctx[task_id]);
+
+  if(task_id == 0)
+  {
+    while(1)
+    {
+      while((msg = (test_msg_t*)mss_mque_read(mque_hdl)) != NULL)
+      {
+        msg_order[num_of_read++] = msg->id;
+        num_of_msg++;
+      }
+
+      // maximum number of messages in the queue
+      if(num_of_msg > max_holders)
+      {
+        max_holders = num_of_msg;
+      }
+      MSS_RETURN(task_ctx[task_id]);
+    }
+  }
+
+  for(i=0 ; i<TEST_NUM_OF_MSG ; i++)
+  {
+    msgs[i].id = i;
+    while(mss_mque_check_space(mque_hdl) == false)
+    {
+      // count how often the task has to wait
+      task_count[task_id]++;
+      MSS_RETURN(task_ctx[task_id]);
+    }
+    if(mss_mque_try_send(mque_hdl, (mss_mque_msg_t*)&msgs[i]) != NULL)
+    {
+      num_of_dropped++;
+    }
+  }
+  task_done[task_id] = true;
+
+  MSS_FINISH();
+}
+
+/**************************************************************************//**
+*
+* test_mque_workq
+*
+* @brief      every message sent to a work queue activates another idle
+*             consumer task
+*
+* @param      -
+*
+* @return     true if the test passed
+*
+******************************************************************************/
+static bool test_mque_workq(void)
+{
+  test_start(workq_task);
+  mque_hdl = mss_mque_create_workq();
+  mss_mque_add_consumer(mque_hdl, 1);
+  mss_mque_add_consumer(mque_hdl, 2);
+
+  mss_mque_try_send(mque_hdl, (mss_mque_msg_t*)&msgs[0]);
+  mss_mque_try_send(mque_hdl, (mss_mque_msg_t*)&msgs[1]);
+  mss_scheduler();
+
+  return (mque_hdl != MSS_MQUE_INVALID_HDL) && (task_count[0] == 0) &&
+         (task_count[1] == 1) && (task_count[2] == 1) && (task_count[3] == 0);
+}
+
+/**************************************************************************//**
+*
+* workq_task
+*
+* @brief      consumer task of the work queue test, reads one message every
+*             time it is activated
+*
+* @param[in]  task_id   task id
+*
+* @return     -
+*
+******************************************************************************/
+static void workq_task(uint8_t task_id)
+{
+  if(mss_mque_read(mque_hdl) != NULL)
+  {
+    task_count[task_id]++;
+  }
+}
+
+/**************************************************************************//**
+*
+* test_topic
+*
+* @brief      all subscribers of a topic get the same published message, and
+*             its buffer is freed after the last subscriber has released it
+*
+* @param      -
+*
+* @return     true if the test passed
+*
+******************************************************************************/
+static bool test_topic(void)
+{
+  test_start(topic_task);
+  topic_hdl = mss_topic_create(sizeof(uint16_t), 2);
+  mss_topic_subscribe(topic_hdl, 1);
+  mss_topic_subscribe(topic_hdl, 2);
+
+  // the subscribers wait, task 0 publishes a message
+  mss_activate_task(1);
+  test_run(2);
+  test_run(0);
+
+  // task 0 allocates both buffers of the topic
+  task_release[0] = true;
+  test_run(0);
+
+  return (topic_hdl != MSS_TOPIC_INVALID_HDL) &&
+         (topic_data[1] != NULL) && (topic_data[1] == topic_data[2]) &&
+         (task_count[1] == 1) && (task_count[2] == 1) && task_done[0];
+}
+
+/**************************************************************************//**
+*
+* topic_task
+*
+* @brief      task of the topic test. Task 0 publishes a message and then
+*             allocates all buffers of the topic, the other tasks read and
+*             release the message
+*
+* @param[in]  task_id   task id
+*
+* @return     -
+*
+******************************************************************************/
+static void topic_task(uint8_t task_id)
+{
+  uint16_t* data;
+
+  MSS_BEGIN(task_ctx[task_id]);
+
+  if(task_id == 0)
+  {
+    data = mss_topic_alloc(topic_hdl);
+    if(data != NULL)
+    {
+      *data = 0x1234;
+      mss_topic_publish(topic_hdl, data);
+    }
+
+    while(!task_release[task_id])
+    {
+      MSS_RETURN(task_ctx[task_id]);
+    }
+
+    task_done[task_id] = (mss_topic_alloc(topic_hdl) != NULL) &&
+                         (mss_topic_alloc(topic_hdl) != NULL);
+  }
+  else
+  {
+    MSS_TOPIC_WAIT(topic_hdl, data, task_ctx[task_id]);
+    topic_data[task_id] = data;
+    if(*data == 0x1234)
+    {
+      task_count[task_id]++;
+    }
+    mss_topic_release(topic_hdl, data);
+  }
+
+  MSS_FINISH();
+}
+
+/**************************************************************************//**
+*
+* test_stream
+*
+* @brief      the reader task of a stream gets the bytes after the trigger
+*             level is reached, also when they wrap around the end of the
+*             stream buffer
+*
+* @param      -
+*
+* @return     true if the test passed
+*
+******************************************************************************/
+static bool test_stream(void)
+{
+  static const uint8_t data[] = "0123456789abcdef";
+  bool ret;
+
+  test_start(stream_task);
+  stream_hdl = mss_stream_create_static(stream_buf, 3, TEST_STREAM_SIZE,
+                                         TEST_STREAM_TRIGGER);
+
+  // below the trigger level nothing is read
+  test_run(3);
+  ret = (mss_stream_write(stream_hdl, &data[0], 3) == 3);
+  mss_scheduler();
+  ret = ret && (stream_out_len == 0);
+
+  // the trigger level is reached
+  ret = ret && (mss_stream_write(stream_hdl, &data[3], 2) == 2);
+  mss_scheduler();
+  ret = ret && (stream_out_len == 5);
+
+  // the stream holds (size - 1) bytes, which wrap around
+  ret = ret && (mss_stream_write(stream_hdl, &data[5], TEST_STREAM_SIZE) ==
+                (TEST_STREAM_SIZE - 1));
+  mss_scheduler();
+
+  return ret && (stream_hdl != MSS_STREAM_INVALID_HDL) &&
+         (stream_out_len == (TEST_STREAM_SIZE + 4)) &&
+         (memcmp(stream_out, data, stream_out_len) == 0);
+}
+
+/**************************************************************************//**
+*
+* stream_task
+*
+* @brief      reader task of the stream test, reads all bytes of the stream
+*             when the stream is ready
+*
+* @param[in]  task_id   task id
+*
+* @return     -
+*
+******************************************************************************/
+static void stream_task(uint8_t task_id)
+{
+  uint8_t* span;
+  uint16_t len;
+
+  MSS_BEGIN(task_ctx[task_id]);
+
+  while(1)
+  {
+    MSS_STREAM_WAIT(stream_hdl, task_ctx[task_id]);
+    while((span = mss_stream_get_span(stream_hdl, &len)) != NULL)
+    {
+      memcpy(&stream_out[stream_out_len], span, len);
+      stream_out_len += len;
+      mss_stream_consume(stream_hdl, len);
+    }
+    MSS_RETURN(task_ctx[task_id]);
+  }
+
+  MSS_FINISH();
+}
@@ -0,0 +1,79 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     mss_hal_int.h
+* 
+* @brief    MSS device specific internal module header file
+* 
+* @version  0.2.1
+*
+* @author   Leo Hendrawan
+* 
+* @remark   target device: host (PC) with POSIX signals as interrupts
+* 
+******************************************************************************/
+
+#ifndef _MSS_HAL_INT_H_
+#define _MSS_HAL_INT_H_
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+//*****************************************************************************
+// Global variable declarations 
+//*****************************************************************************
+
+
+//*****************************************************************************
+// Macros (defines) and data types 
+//*****************************************************************************
+
+/** MSS_ENABLE_GLOBAL_INTERRUPT
+ *  enable global interrupt of the target device. This function is only called
+ *  once in @ref mss_run() function.
+ */
+#define MSS_ENABLE_GLOBAL_INTERRUPT()                                  \
+        sigprocmask(SIG_UNBLOCK, &mss_hal_all_signals, NULL)
+
+#if (MSS_ISR_FAST_PATH == TRUE)
+/** MSS_ATOMIC_OR
+ *  set bits in a variable with a read-modify-write operation which can not
+ *  be interrupted. Needed only if @ref MSS_ISR_FAST_PATH is set to TRUE.
+ */
+#define MSS_ATOMIC_OR(var, bits)                                       \
+        ((void)__atomic_fetch_or(&(var), (bits), __ATOMIC_SEQ_CST))
+#endif /* (MSS_ISR_FAST_PATH == TRUE) */
+
+//*****************************************************************************
+// External function declarations
+//*****************************************************************************
+
+#endif /* _MSS_HAL_INT_H_*/
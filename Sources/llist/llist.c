@@ -47,8 +47,6 @@
 #include "dev_types.h"
 #include "llist.h"
 
-#if (MAX_NUM_OF_LLIST > 0)
-
 //*****************************************************************************
 // Global variables 
 //*****************************************************************************
@@ -58,13 +56,14 @@
 // Macros (defines), data types, static variables
 //*****************************************************************************
 
-// data structure definition of llist_t
-struct llist_tbl_t {
-  void *first;  // first object in the linked list
-#if (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE)
-  void *last;   // last object in the linked list
-#endif  
-};
+// update the number of objects in the linked list
+#if (LLIST_USE_COUNT == TRUE)
+#define LL_COUNT_ADD(hdl, num)      ((hdl)->count += (num))
+#define LL_COUNT_SUB(hdl, num)      ((hdl)->count -= (num))
+#else
+#define LL_COUNT_ADD(hdl, num)
+#define LL_COUNT_SUB(hdl, num)
+#endif /* (LLIST_USE_COUNT == TRUE) */
 
 // linked list data header
 typedef struct {
@@ -74,12 +73,17 @@ typedef struct {
 #endif /* (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE) */
 } llist_hdr_t;
 
+#if (MAX_NUM_OF_LLIST > 0)
 // table of linked list
-static struct llist_tbl_t ll_tbl[MAX_NUM_OF_LLIST];
+static llist_head_t ll_tbl[MAX_NUM_OF_LLIST];
 
 // number of created single linked list
 static uint8_t num_of_ll = 0;
 
+// destroyed linked lists, linked through their first pointer
+static llist_t free_ll = LLIST_INVALID_HDL;
+#endif /* (MAX_NUM_OF_LLIST > 0) */
+
 //*****************************************************************************
 // Internal function declarations
 //*****************************************************************************
@@ -91,6 +95,7 @@ static void ll_add(llist_t hdl, void* object, bool first);
 // External functions
 //*****************************************************************************
 
+#if (MAX_NUM_OF_LLIST > 0)
 /**************************************************************************//**
 *
 * llist_create
@@ -107,22 +112,89 @@ llist_t llist_create(void)
 {
   llist_t ret_hdl = LLIST_INVALID_HDL;
 
-  // check number of created single linked list
-  if(num_of_ll < MAX_NUM_OF_LLIST)
+  if(free_ll != LLIST_INVALID_HDL)
+  {
+    // reuse a destroyed linked list
+    ret_hdl = free_ll;
+    free_ll = (llist_t)free_ll->first;
+  }
+  else if(num_of_ll < MAX_NUM_OF_LLIST)
   {
     // return pointer to the single linked list table
     ret_hdl = &ll_tbl[num_of_ll++];
+  }
 
+  if(ret_hdl != LLIST_INVALID_HDL)
+  {
     // initialize table item
-    ret_hdl->first = NULL;
-#if (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE)
-    ret_hdl->last = NULL;
-#endif /* (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE) */
+    llist_init(ret_hdl);
   }
   
   return ret_hdl;
 }
 
+/**************************************************************************//**
+*
+* llist_destroy
+*
+* @brief      destroy an empty linked list created with llist_create, its
+*             handle can be given out again by llist_create
+*
+* @param[in]  hdl      handle of the linked list
+*
+* @return     -
+*
+* @remark     a linked list initialized with llist_init is not returned to
+*             the linked list table, the handle is just not used anymore.
+*             Destroying a linked list twice has no effect
+*
+******************************************************************************/
+void llist_destroy(llist_t hdl)
+{
+  // check parameters, a destroyed linked list is marked by its last
+  // pointer pointing to itself
+  LLIST_ASSERT((hdl != LLIST_INVALID_HDL) && (hdl->first == NULL) &&
+               (hdl->last != (void*)hdl));
+
+  // only linked lists from the table are put into the free list, and only
+  // once
+  if((hdl >= &ll_tbl[0]) && (hdl < &ll_tbl[num_of_ll]) &&
+     (hdl->last != (void*)hdl))
+  {
+    hdl->first = free_ll;
+    hdl->last = hdl;
+    free_ll = hdl;
+  }
+}
+#endif /* (MAX_NUM_OF_LLIST > 0) */
+
+/**************************************************************************//**
+*
+* llist_init
+*
+* @brief      initialize a linked list head provided by the caller (e.g.
+*             embedded in a structure or on the stack) as an empty linked
+*             list, without using the linked list table
+*
+* @param[in]  head     pointer to the linked list head
+*
+* @return     handle of the linked list (equals to head)
+*
+******************************************************************************/
+llist_t llist_init(llist_head_t* head)
+{
+  // check parameters
+  LLIST_ASSERT(head != NULL);
+
+  head->first = NULL;
+  head->last = NULL;
+#if (LLIST_USE_COUNT == TRUE)
+  head->count = 0;
+#endif /* (LLIST_USE_COUNT == TRUE) */
+
+  return head;
+}
+
 /**************************************************************************//**
 *
 * llist_add_first
@@ -216,7 +288,6 @@ void* llist_get_first(llist_t hdl)
 	  // set return value pointer
 	  ret_obj = hdl->first;
 
-  #if (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE)
     if(hdl->last == hdl->first)
     {
       // the only object in list, set pointers as NULL
@@ -224,16 +295,163 @@ void* llist_get_first(llist_t hdl)
       hdl->last = NULL;
     }
     else
-  #endif /* (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE) */
     {
       // set new pointer of the first object in linked list
-      hdl->first = ((llist_hdr_t*)hdl->first)->next;    
+      hdl->first = ((llist_hdr_t*)hdl->first)->next;
+    #if (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE)
+      ((llist_hdr_t*)hdl->first)->prev = NULL;
+    #endif /* (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE) */
     }
+
+    LL_COUNT_SUB(hdl, 1);
   }
 
   return ret_obj;
 }
 
+/**************************************************************************//**
+*
+* llist_get_last
+*
+* @brief      remove and return the pointer of the last object of a linked
+*             list
+*
+* @param[in]  hdl      handle of the linked list
+*
+* @return     pointer to the last object in the linked list, NULL if no
+*             object is found in the list
+*
+* @remark     constant time for double linked list. For single linked list
+*             the object before the last object is searched from the first
+*             object
+*
+******************************************************************************/
+void* llist_get_last(llist_t hdl)
+{
+  void *ret_obj, *prev_obj = NULL;
+
+  // check parameters
+  LLIST_ASSERT(hdl != LLIST_INVALID_HDL);
+
+  ret_obj = hdl->last;
+
+  // check whether there is an object in the linked list
+  if(ret_obj != NULL)
+  {
+  #if (LLIST_ENABLE_DOUBLE_LINKED_LIST != TRUE)
+    // search the object before the last object
+    if(ret_obj != hdl->first)
+    {
+      for(prev_obj = hdl->first ; ((llist_hdr_t*)prev_obj)->next != ret_obj ;
+          prev_obj = ((llist_hdr_t*)prev_obj)->next);
+    }
+  #else
+    prev_obj = ((llist_hdr_t*)ret_obj)->prev;
+  #endif /* (LLIST_ENABLE_DOUBLE_LINKED_LIST != TRUE) */
+
+    if(prev_obj == NULL)
+    {
+      // the only object in list
+      hdl->first = NULL;
+    }
+    else
+    {
+      // the object before becomes the end of the list
+      ((llist_hdr_t*)prev_obj)->next = NULL;
+    }
+    hdl->last = prev_obj;
+
+    LL_COUNT_SUB(hdl, 1);
+  }
+
+  return ret_obj;
+}
+
+/**************************************************************************//**
+*
+* llist_count
+*
+* @brief      get the number of objects in a linked list
+*
+* @param[in]  hdl      handle of the linked list
+*
+* @return     number of objects in the linked list
+*
+* @remark     constant time if LLIST_USE_COUNT is TRUE, otherwise the objects
+*             are counted by going through the list
+*
+******************************************************************************/
+uint16_t llist_count(llist_t hdl)
+{
+#if (LLIST_USE_COUNT == TRUE)
+  // check parameters
+  LLIST_ASSERT(hdl != LLIST_INVALID_HDL);
+
+  return hdl->count;
+#else
+  uint16_t ret = 0;
+  void *obj;
+
+  // check parameters
+  LLIST_ASSERT(hdl != LLIST_INVALID_HDL);
+
+  for(obj = hdl->first ; obj != NULL ; obj = ((llist_hdr_t*)obj)->next)
+  {
+    ret++;
+  }
+
+  return ret;
+#endif /* (LLIST_USE_COUNT == TRUE) */
+}
+
+/**************************************************************************//**
+*
+* llist_splice
+*
+* @brief      move all objects of a linked list to the last position of
+*             another linked list in constant time
+*
+* @param[in]  dst      handle of the linked list getting the objects
+*
+* @param[in]  src      handle of the linked list giving the objects, will be
+*                      empty afterwards
+*
+* @return     -
+*
+******************************************************************************/
+void llist_splice(llist_t dst, llist_t src)
+{
+  // check parameters
+  LLIST_ASSERT((dst != LLIST_INVALID_HDL) && (src != LLIST_INVALID_HDL) &&
+               (dst != src));
+
+  if(src->first != NULL)
+  {
+    if(dst->first == NULL)
+    {
+      // empty list, the objects become the whole list
+      dst->first = src->first;
+    }
+    else
+    {
+      // link the objects after the last object in the list
+      ((llist_hdr_t*)dst->last)->next = src->first;
+    #if (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE)
+      ((llist_hdr_t*)src->first)->prev = dst->last;
+    #endif /* (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE) */
+    }
+    dst->last = src->last;
+
+    // empty the source list
+    src->first = NULL;
+    src->last = NULL;
+  #if (LLIST_USE_COUNT == TRUE)
+    dst->count += src->count;
+    src->count = 0;
+  #endif /* (LLIST_USE_COUNT == TRUE) */
+  }
+}
+
 /**************************************************************************//**
 *
 * llist_remove
@@ -279,6 +497,14 @@ void llist_remove(llist_t hdl, void* object)
           // this must be the first object in the list
           hdl->first = ((llist_hdr_t*)cur_obj)->next;
         }
+
+        if(cur_obj == hdl->last)
+        {
+          // removed the last object in the list
+          hdl->last = prev_obj;
+        }
+
+        LL_COUNT_SUB(hdl, 1);
         break;
       }
 
@@ -312,10 +538,147 @@ void llist_remove(llist_t hdl, void* object)
       LLIST_ASSERT(prev_obj == hdl->first);
       hdl->first = next_obj;
     }    
+
+    LL_COUNT_SUB(hdl, 1);
 #endif    
   }
 }
 
+/**************************************************************************//**
+*
+* llist_insert_after
+*
+* @brief      add an object into a linked list directly after another object
+*
+* @param[in]  hdl        handle of the linked list
+*
+* @param[in]  prev_obj   pointer of the object in the linked list after which
+*                        the object will be added, NULL to add the object
+*                        into the first position
+*
+* @param[in]  object     pointer object to be added into the linked list
+*
+* @return     -
+*
+******************************************************************************/
+void llist_insert_after(llist_t hdl, void* prev_obj, void* object)
+{
+  void *next_obj;
+
+  if((prev_obj == NULL) || (prev_obj == hdl->last))
+  {
+    // add into the first or last position
+    ll_add(hdl, object, (prev_obj == NULL));
+  }
+  else
+  {
+    // check parameters
+    LLIST_ASSERT((hdl != LLIST_INVALID_HDL) && (object != NULL));
+
+    // link the object between prev_obj and its next object
+    next_obj = ((llist_hdr_t*)prev_obj)->next;
+    ((llist_hdr_t*)object)->next = next_obj;
+    ((llist_hdr_t*)prev_obj)->next = object;
+  #if (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE)
+    ((llist_hdr_t*)object)->prev = prev_obj;
+    ((llist_hdr_t*)next_obj)->prev = object;
+  #endif /* (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE) */
+
+    LL_COUNT_ADD(hdl, 1);
+  }
+}
+
+/**************************************************************************//**
+*
+* llist_get_all
+*
+* @brief      remove all objects of a linked list at once and return them as
+*             a chain linked by their next pointers (terminated by NULL)
+*
+* @param[in]  hdl      handle of the linked list
+*
+* @return     pointer to the first object of the chain, NULL if the list is
+*             empty
+*
+******************************************************************************/
+void* llist_get_all(llist_t hdl)
+{
+  void *ret_obj;
+
+  // check parameters
+  LLIST_ASSERT(hdl != LLIST_INVALID_HDL);
+
+  // detach the whole chain from the list
+  ret_obj = hdl->first;
+  hdl->first = NULL;
+  hdl->last = NULL;
+#if (LLIST_USE_COUNT == TRUE)
+  hdl->count = 0;
+#endif /* (LLIST_USE_COUNT == TRUE) */
+
+  return ret_obj;
+}
+
+/**************************************************************************//**
+*
+* llist_add_chain_last
+*
+* @brief      add a chain of objects, which are already linked by their next
+*             pointers, into the last position of a linked list
+*
+* @param[in]  hdl        handle of the linked list
+*
+* @param[in]  first_obj  pointer of the first object of the chain
+*
+* @param[in]  last_obj   pointer of the last object of the chain
+*
+* @return     -
+*
+* @remark     constant time for single linked list. For double linked list
+*             the prev pointers of the chain are set by walking the chain
+*
+******************************************************************************/
+void llist_add_chain_last(llist_t hdl, void* first_obj, void* last_obj)
+{
+#if ((LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE) || (LLIST_USE_COUNT == TRUE))
+  void *obj;
+#endif
+#if (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE)
+  void *prev_obj = hdl->last;
+#endif /* (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE) */
+
+  // check parameters
+  LLIST_ASSERT((hdl != LLIST_INVALID_HDL) && (first_obj != NULL) &&
+               (last_obj != NULL));
+
+  // mark the last object of the chain as the end of the list
+  ((llist_hdr_t*)last_obj)->next = NULL;
+
+#if ((LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE) || (LLIST_USE_COUNT == TRUE))
+  // set the prev pointers and count the objects of the chain
+  for(obj = first_obj ; obj != NULL ; obj = ((llist_hdr_t*)obj)->next)
+  {
+  #if (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE)
+    ((llist_hdr_t*)obj)->prev = prev_obj;
+    prev_obj = obj;
+  #endif /* (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE) */
+    LL_COUNT_ADD(hdl, 1);
+  }
+#endif
+
+  if(hdl->first == NULL)
+  {
+    // empty list, the chain becomes the whole list
+    hdl->first = first_obj;
+  }
+  else
+  {
+    // link the chain after the last object in the list
+    ((llist_hdr_t*)hdl->last)->next = first_obj;
+  }
+  hdl->last = last_obj;
+}
+
 /**************************************************************************//**
 *
 * llist_sort
@@ -333,83 +696,122 @@ void llist_remove(llist_t hdl, void* object)
 *
 * @return     -
 *
+* @remark     stable bottom up merge sort, O(n log n) without recursion.
+*             Sorts linked lists of up to 65535 objects
+*
 ******************************************************************************/
 void llist_sort(llist_t hdl, int8_t (*comp_func)(void*, void*))
 {
-#if (LLIST_ENABLE_DOUBLE_LINKED_LIST != TRUE)
-  void *last_obj1;
-#endif /* (LLIST_ENABLE_DOUBLE_LINKED_LIST != TRUE) */  
-  void  *obj1, *obj2, *next_obj1, *next_obj2, *temp;
-  bool swapped;
+  void *list, *obj1, *obj2, *obj, *tail;
+  uint16_t run_len, num_of_merges, len1, len2;
 
   // check parameters
   LLIST_ASSERT((hdl != LLIST_INVALID_HDL) && (comp_func != NULL));
 
-  do
+  // bottom up merge sort: merge neighbouring sorted runs of run_len objects
+  // into runs of (2 * run_len) objects until only one run is left. run_len
+  // wraps to zero after the pass with runs of 32768 objects, every list of
+  // up to 65535 objects is sorted by then
+  list = hdl->first;
+  tail = NULL;
+  for(run_len = 1, num_of_merges = 2 ; (num_of_merges > 1) && (run_len != 0) ;
+      run_len <<= 1)
   {
-    // reset flag
-    swapped = false;
+    obj1 = list;
+    list = NULL;
+    tail = NULL;
+    num_of_merges = 0;
 
-#if (LLIST_ENABLE_DOUBLE_LINKED_LIST != TRUE)
-    for(last_obj1 = NULL, obj1 = hdl->first,
-        obj2 = ((obj1 == NULL) ? NULL : ((llist_hdr_t*)obj1)->next);
-        obj2 != NULL ;
-        obj1 = next_obj1, obj2 = next_obj2)
-#else        
-    for(obj1 = hdl->first,
-        obj2 = ((obj1 == NULL) ? NULL : ((llist_hdr_t*)obj1)->next);
-        obj2 != NULL ;
-        obj1 = next_obj1, obj2 = next_obj2)
-#endif /* (LLIST_ENABLE_DOUBLE_LINKED_LIST != TRUE) */
+    while(obj1 != NULL)
     {
-      if(comp_func(obj1, obj2) > 0)
+      num_of_merges++;
+
+      // the second run starts run_len objects after the first run
+      for(obj2 = obj1, len1 = 0 ; (obj2 != NULL) && (len1 < run_len) ; len1++)
+      {
+        obj2 = ((llist_hdr_t*)obj2)->next;
+      }
+      len2 = run_len;
+
+      // merge both runs, take from the first run if equal to keep the order
+      // of equal objects
+      while((len1 > 0) || ((len2 > 0) && (obj2 != NULL)))
       {
-        // swap the objects
-        if(obj1 == hdl->first)
+        if((len1 > 0) &&
+           ((len2 == 0) || (obj2 == NULL) || (comp_func(obj1, obj2) <= 0)))
         {
-          hdl->first = obj2;
+          obj = obj1;
+          obj1 = ((llist_hdr_t*)obj1)->next;
+          len1--;
         }
-
-        // update the next pointers
-        temp = ((llist_hdr_t*)obj2)->next;
-        ((llist_hdr_t*)obj2)->next = obj1;
-        ((llist_hdr_t*)obj1)->next = temp;
-
-      #if (LLIST_ENABLE_DOUBLE_LINKED_LIST != TRUE)
-        if(last_obj1 != NULL)
+        else
         {
-          ((llist_hdr_t*)last_obj1)->next = obj2;
+          obj = obj2;
+          obj2 = ((llist_hdr_t*)obj2)->next;
+          len2--;
         }
 
-        // set pointers for next iterations
-        last_obj1 = obj2;
-        next_obj1 = obj1;
-        next_obj2 = ((llist_hdr_t*)obj1)->next;
-      #else
-        // update the prev pointers
-        temp = ((llist_hdr_t*)obj1)->prev;
-        ((llist_hdr_t*)obj2)->prev = temp;
-        ((llist_hdr_t*)obj1)->prev = obj2;
-      
-        // set pointers for next iterations
-        next_obj1 = obj1;
-        next_obj2 = ((llist_hdr_t*)obj1)->next;
-      #endif /* (LLIST_ENABLE_DOUBLE_LINKED_LIST != TRUE) */
-
-        // set flag
-        swapped = true;
-      }
-      else
-      {
-        // set pointers for next iterations
-      #if (LLIST_ENABLE_DOUBLE_LINKED_LIST != TRUE)
-      	last_obj1 = obj1;
-      #endif /* (LLIST_ENABLE_DOUBLE_LINKED_LIST != TRUE) */
-        next_obj1 = obj2;
-        next_obj2 = ((llist_hdr_t*)obj2)->next;
+        // append the object to the merged list
+        if(tail == NULL)
+        {
+          list = obj;
+        }
+        else
+        {
+          ((llist_hdr_t*)tail)->next = obj;
+        }
+      #if (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE)
+        ((llist_hdr_t*)obj)->prev = tail;
+      #endif /* (LLIST_ENABLE_DOUBLE_LINKED_LIST == TRUE) */
+        tail = obj;
       }
+
+      // continue with the runs after the second run
+      obj1 = obj2;
     }
-  }while(swapped == true);
+
+    if(tail != NULL)
+    {
+      ((llist_hdr_t*)tail)->next = NULL;
+    }
+  }
+
+  hdl->first = list;
+  hdl->last = tail;
+}
+
+/**************************************************************************//**
+*
+* llist_insert_sorted
+*
+* @brief      add an object into a sorted linked list, after all objects which
+*             are less than or equal to the object
+*
+* @param[in]  hdl        handle of the linked list
+*
+* @param[in]  object     pointer object to be added into the linked list
+*
+* @param[in]  comp_func  pointer to callback function for comparing two objects
+*                        in the linked list (see llist_sort)
+*
+* @return     -
+*
+******************************************************************************/
+void llist_insert_sorted(llist_t hdl, void* object,
+                         int8_t (*comp_func)(void*, void*))
+{
+  void *prev_obj, *obj;
+
+  // check parameters
+  LLIST_ASSERT((hdl != LLIST_INVALID_HDL) && (object != NULL) &&
+               (comp_func != NULL));
+
+  // search the last object which is not greater than the object
+  for(prev_obj = NULL, obj = hdl->first ;
+      (obj != NULL) && (comp_func(obj, object) <= 0) ;
+      prev_obj = obj, obj = ((llist_hdr_t*)obj)->next);
+
+  llist_insert_after(hdl, prev_obj, object);
 }
 
 #if (LLIST_DEBUG_MODE == TRUE)
@@ -476,12 +878,20 @@ void llist_check(llist_t hdl, bool (*callback)(void*))
 static void ll_add(llist_t hdl, void* object, bool first)
 {
 #if (LLIST_ENABLE_DOUBLE_LINKED_LIST != TRUE)
-  void* cur_obj;
-
   // check parameters
   LLIST_ASSERT((hdl != LLIST_INVALID_HDL) && (object != NULL));
 
-  if((first) || (hdl->first == NULL))
+  if(hdl->first == NULL)
+  {
+    // must be an empty list
+    LLIST_ASSERT(hdl->last == NULL);
+
+    // put object as the only object in the list
+    ((llist_hdr_t*)object)->next = NULL;
+    hdl->first = object;
+    hdl->last = object;
+  }
+  else if(first)
   {
     // set the next pointer object as the previous first object
     ((llist_hdr_t*)object)->next = hdl->first;
@@ -491,20 +901,12 @@ static void ll_add(llist_t hdl, void* object, bool first)
   }
   else
   {
-    // point to the beginning of the list
-    cur_obj = hdl->first;
-
-    // search for the last object in list
-    while(((llist_hdr_t*)cur_obj)->next != NULL)
-    {
-      cur_obj = ((llist_hdr_t*)cur_obj)->next;
-    }
-
-    // put the object in the end of the list
-    ((llist_hdr_t*)cur_obj)->next = object;
+    // put the object after the last object in the list
+    ((llist_hdr_t*)hdl->last)->next = object;
 
     // mark the object as the end of the list
     ((llist_hdr_t*)object)->next = NULL;
+    hdl->last = object;
   }
 #else
   // check parameters
@@ -550,7 +952,7 @@ static void ll_add(llist_t hdl, void* object, bool first)
     ((llist_hdr_t*)object)->next = NULL;
   }
 #endif /* (LLIST_ENABLE_DOUBLE_LINKED_LIST != TRUE) */
-}
 
-#endif /* (MAX_NUM_OF_LLIST > 0) */
+  LL_COUNT_ADD(hdl, 1);
+}
 
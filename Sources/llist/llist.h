@@ -71,6 +71,22 @@
  * @{
  */
 
+/** llist_head_t
+ *  linked list head data type. Can be embedded in a structure or allocated
+ *  on the stack and initialized with llist_init, its address is then the
+ *  handle of the linked list
+ */
+typedef struct llist_tbl_t {
+  /** first object in the linked list */
+  void *first;
+  /** last object in the linked list */
+  void *last;
+#if (LLIST_USE_COUNT == TRUE)
+  /** number of objects in the linked list */
+  uint16_t count;
+#endif /* (LLIST_USE_COUNT == TRUE) */
+} llist_head_t;
+
 /** llist_t
  *  single linked list handle data type
  */
@@ -101,6 +117,7 @@ typedef struct llist_tbl_t* llist_t;
  * @{
  */
 
+#if (MAX_NUM_OF_LLIST > 0)
 /**************************************************************************//**
 *
 * llist_create
@@ -115,6 +132,40 @@ typedef struct llist_tbl_t* llist_t;
 ******************************************************************************/
 llist_t llist_create(void);
 
+/**************************************************************************//**
+*
+* llist_destroy
+*
+* @brief      destroy an empty linked list created with llist_create, its
+*             handle can be given out again by llist_create
+*
+* @param[in]  hdl      handle of the linked list
+*
+* @return     -
+*
+* @remark     a linked list initialized with llist_init is not returned to
+*             the linked list table, the handle is just not used anymore.
+*             Destroying a linked list twice has no effect
+*
+******************************************************************************/
+void llist_destroy(llist_t hdl);
+#endif /* (MAX_NUM_OF_LLIST > 0) */
+
+/**************************************************************************//**
+*
+* llist_init
+*
+* @brief      initialize a linked list head provided by the caller (e.g.
+*             embedded in a structure or on the stack) as an empty linked
+*             list, without using the linked list table
+*
+* @param[in]  head     pointer to the linked list head
+*
+* @return     handle of the linked list (equals to head)
+*
+******************************************************************************/
+llist_t llist_init(llist_head_t* head);
+
 /**************************************************************************//**
 *
 * llist_add_first
@@ -185,6 +236,58 @@ void* llist_touch_first(llist_t hdl);
 ******************************************************************************/
 void* llist_get_first(llist_t hdl);
 
+/**************************************************************************//**
+*
+* llist_get_last
+*
+* @brief      remove and return the pointer of the last object of a linked
+*             list
+*
+* @param[in]  hdl      handle of the linked list
+*
+* @return     pointer to the last object in the linked list, NULL if no
+*             object is found in the list
+*
+* @remark     constant time for double linked list. For single linked list
+*             the object before the last object is searched from the first
+*             object
+*
+******************************************************************************/
+void* llist_get_last(llist_t hdl);
+
+/**************************************************************************//**
+*
+* llist_count
+*
+* @brief      get the number of objects in a linked list
+*
+* @param[in]  hdl      handle of the linked list
+*
+* @return     number of objects in the linked list
+*
+* @remark     constant time if LLIST_USE_COUNT is TRUE, otherwise the objects
+*             are counted by going through the list
+*
+******************************************************************************/
+uint16_t llist_count(llist_t hdl);
+
+/**************************************************************************//**
+*
+* llist_splice
+*
+* @brief      move all objects of a linked list to the last position of
+*             another linked list in constant time
+*
+* @param[in]  dst      handle of the linked list getting the objects
+*
+* @param[in]  src      handle of the linked list giving the objects, will be
+*                      empty afterwards
+*
+* @return     -
+*
+******************************************************************************/
+void llist_splice(llist_t dst, llist_t src);
+
 /**************************************************************************//**
 *
 * llist_remove
@@ -200,6 +303,61 @@ void* llist_get_first(llist_t hdl);
 ******************************************************************************/
 void llist_remove(llist_t hdl, void* object);
 
+/**************************************************************************//**
+*
+* llist_insert_after
+*
+* @brief      add an object into a linked list directly after another object
+*
+* @param[in]  hdl        handle of the linked list
+*
+* @param[in]  prev_obj   pointer of the object in the linked list after which
+*                        the object will be added, NULL to add the object
+*                        into the first position
+*
+* @param[in]  object     pointer object to be added into the linked list
+*
+* @return     -
+*
+******************************************************************************/
+void llist_insert_after(llist_t hdl, void* prev_obj, void* object);
+
+/**************************************************************************//**
+*
+* llist_get_all
+*
+* @brief      remove all objects of a linked list at once and return them as
+*             a chain linked by their next pointers (terminated by NULL)
+*
+* @param[in]  hdl      handle of the linked list
+*
+* @return     pointer to the first object of the chain, NULL if the list is
+*             empty
+*
+******************************************************************************/
+void* llist_get_all(llist_t hdl);
+
+/**************************************************************************//**
+*
+* llist_add_chain_last
+*
+* @brief      add a chain of objects, which are already linked by their next
+*             pointers, into the last position of a linked list
+*
+* @param[in]  hdl        handle of the linked list
+*
+* @param[in]  first_obj  pointer of the first object of the chain
+*
+* @param[in]  last_obj   pointer of the last object of the chain
+*
+* @return     -
+*
+* @remark     constant time for single linked list. For double linked list
+*             the prev pointers of the chain are set by walking the chain
+*
+******************************************************************************/
+void llist_add_chain_last(llist_t hdl, void* first_obj, void* last_obj);
+
 /**************************************************************************//**
 *
 * llist_sort
@@ -217,9 +375,32 @@ void llist_remove(llist_t hdl, void* object);
 *
 * @return     -
 *
+* @remark     stable bottom up merge sort, O(n log n) without recursion.
+*             Sorts linked lists of up to 65535 objects
+*
 ******************************************************************************/
 void llist_sort(llist_t hdl, int8_t (*comp_func)(void*, void*));
 
+/**************************************************************************//**
+*
+* llist_insert_sorted
+*
+* @brief      add an object into a sorted linked list, after all objects which
+*             are less than or equal to the object
+*
+* @param[in]  hdl        handle of the linked list
+*
+* @param[in]  object     pointer object to be added into the linked list
+*
+* @param[in]  comp_func  pointer to callback function for comparing two objects
+*                        in the linked list (see llist_sort)
+*
+* @return     -
+*
+******************************************************************************/
+void llist_insert_sorted(llist_t hdl, void* object,
+                         int8_t (*comp_func)(void*, void*));
+
 #if (LLIST_DEBUG_MODE == TRUE)
 /**************************************************************************//**
 *
@@ -71,6 +71,14 @@ mss_task_bits_t mss_ready_task_bits = MSS_READY_TASK_BITS_INIT;
  */
 const mss_task_bits_t mss_bitpos_to_bit[] = MSS_TASK_BIT_POS;
 
+#if (MSS_ISR_FAST_PATH == TRUE)
+/** mss_isr_ready_task_bits
+ *  flag bits of tasks activated by ISR fast path which are not yet taken
+ *  over into mss_ready_task_bits by the scheduler
+ */
+volatile mss_task_bits_t mss_isr_ready_task_bits = 0;
+#endif /* (MSS_ISR_FAST_PATH == TRUE) */
+
 #if (MSS_PREEMPTIVE_SCHEDULING == TRUE)
 /** mss_task_preempted
  *  flag to indicate whether a task is currently preempted by another task
@@ -78,6 +86,14 @@ const mss_task_bits_t mss_bitpos_to_bit[] = MSS_TASK_BIT_POS;
 mss_task_bits_t mss_task_preempted = 0;
 #endif /* (MSS_PREEMPTIVE_SCHEDULING == TRUE) */
 
+#if (MSS_TASK_USE_MUTEX == TRUE)
+/** mss_running_task_prio
+ *  priority of currently running mss task, raised to the ceiling of the
+ *  mutexes it has locked
+ */
+uint8_t mss_running_task_prio = MSS_INVALID_TASK_ID;
+#endif /* (MSS_TASK_USE_MUTEX == TRUE) */
+
 //*****************************************************************************
 // Macros (defines), data types, static variables
 //*****************************************************************************
@@ -99,6 +115,11 @@ static mss_task_list_entry_t mss_task_list[MSS_NUM_OF_TASKS] = MSS_TASK_LIST;
 // Internal function declarations
 //*****************************************************************************
 
+static mss_task_bits_t mss_set_task_bits(mss_task_bits_t task_bits);
+
+#if (MSS_ISR_FAST_PATH == TRUE)
+static void mss_isr_ready_merge(void);
+#endif /* (MSS_ISR_FAST_PATH == TRUE) */
 
 //*****************************************************************************
 // External functions
@@ -130,6 +151,11 @@ void mss_init(void)
   // initialize MSS timer
   mss_timer_init();
 #endif
+
+#if (MSS_TASK_USE_BUF == TRUE)
+  // initialize MSS buffer
+  mss_buf_init();
+#endif
 }
 
 /**************************************************************************//**
@@ -159,6 +185,11 @@ void mss_run(void)
     // really necessary to go sleep
     MSS_ENTER_CRITICAL_SECTION(int_flag);
 
+  #if (MSS_ISR_FAST_PATH == TRUE)
+    // take over tasks activated by ISR fast path
+    mss_isr_ready_merge();
+  #endif /* (MSS_ISR_FAST_PATH == TRUE) */
+
     if(mss_ready_task_bits == 0)
     {
       // sleep if no task is active
@@ -188,29 +219,49 @@ void mss_scheduler(void)
 {
   uint8_t highest_prio;
   mss_int_flag_t int_flag;
+#if (MSS_PREEMPTIVE_SCHEDULING == TRUE)
+  uint8_t preempted_task_id, preempted_task_prio;
+#endif /* (MSS_PREEMPTIVE_SCHEDULING == TRUE) */
 
   MSS_ENTER_CRITICAL_SECTION(int_flag);
 
+#if (MSS_PREEMPTIVE_SCHEDULING == TRUE)
+  // save the task which is preempted by this scheduler call (if any)
+  preempted_task_id = mss_running_task_id;
+  preempted_task_prio = MSS_RUNNING_TASK_PRIO;
+#endif /* (MSS_PREEMPTIVE_SCHEDULING == TRUE) */
+
   do
   {
+#if (MSS_ISR_FAST_PATH == TRUE)
+    // take over tasks activated by ISR fast path
+    mss_isr_ready_merge();
+#endif /* (MSS_ISR_FAST_PATH == TRUE) */
+
     // get the highest priority task
     highest_prio = mss_get_highest_prio_task(mss_ready_task_bits);
 
-    // set running task id
-    mss_running_task_id = highest_prio;
-
 #if (MSS_PREEMPTIVE_SCHEDULING == TRUE)
-    // only execute if the task is not being preempted
-    // otherwise it is left somewhere beneath the memory stack
-    if(mss_task_preempted & mss_bitpos_to_bit[highest_prio])
+    // only execute tasks with higher priority than the (mutex ceiling)
+    // priority of the preempted task, otherwise go back to the preempted
+    // task which is left somewhere beneath the memory stack
+    if(highest_prio >= preempted_task_prio)
     {
       // leave the scheduler function
       break;
     }
 #endif /* (MSS_PREEMPTIVE_SCHEDULING == TRUE) */
 
+    // set running task id
+    mss_running_task_id = highest_prio;
+
     if(highest_prio != MSS_INVALID_TASK_ID)
     {
+#if (MSS_TASK_USE_MUTEX == TRUE)
+      // task runs with its own priority until it locks a mutex
+      mss_running_task_prio = highest_prio;
+#endif /* (MSS_TASK_USE_MUTEX == TRUE) */
+
       MSS_LEAVE_CRITICAL_SECTION(int_flag);
 
       // execute task
@@ -220,6 +271,9 @@ void mss_scheduler(void)
 
       // set running task id to none
       mss_running_task_id = MSS_INVALID_TASK_ID;
+#if (MSS_TASK_USE_MUTEX == TRUE)
+      mss_running_task_prio = MSS_INVALID_TASK_ID;
+#endif /* (MSS_TASK_USE_MUTEX == TRUE) */
 
 #if (MSS_PREEMPTIVE_SCHEDULING == TRUE)
       // always clear the preemptive bit after a task has been executed
@@ -240,6 +294,14 @@ void mss_scheduler(void)
     }
   }while(highest_prio != MSS_INVALID_TASK_ID);
 
+#if (MSS_PREEMPTIVE_SCHEDULING == TRUE)
+  // back to the preempted task
+  mss_running_task_id = preempted_task_id;
+#if (MSS_TASK_USE_MUTEX == TRUE)
+  mss_running_task_prio = preempted_task_prio;
+#endif /* (MSS_TASK_USE_MUTEX == TRUE) */
+#endif /* (MSS_PREEMPTIVE_SCHEDULING == TRUE) */
+
   MSS_LEAVE_CRITICAL_SECTION(int_flag);
 }
 
@@ -301,7 +363,7 @@ void mss_activate_task_int(uint8_t task_id)
   #if (MSS_PREEMPTIVE_SCHEDULING == TRUE)
     if(mss_running_task_id != MSS_INVALID_TASK_ID)
     {
-      if(task_id < mss_running_task_id)
+      if(task_id < MSS_RUNNING_TASK_PRIO)
       {
         // do the preemption, first set the preemption bit
         mss_task_preempted |= mss_bitpos_to_bit[mss_running_task_id];
@@ -316,6 +378,108 @@ void mss_activate_task_int(uint8_t task_id)
   }
 }
 
+/**************************************************************************//**
+*
+* mss_activate_tasks_int
+*
+* @brief      internal MSS function to put several tasks into active state
+*             at once - not reentrant
+*
+* @param[in]  task_bits   bits of the tasks to be activated
+*
+* @return     -
+*
+******************************************************************************/
+void mss_activate_tasks_int(mss_task_bits_t task_bits)
+{
+  // mark tasks as ready or reactivated
+  task_bits = mss_set_task_bits(task_bits);
+
+#if (MSS_PREEMPTIVE_SCHEDULING == TRUE)
+  if((task_bits != 0) && (mss_running_task_id != MSS_INVALID_TASK_ID))
+  {
+    // don't call the scheduler directly, let the software interrupt
+    // does the job
+    mss_hal_trigger_sw_int();
+  }
+#endif /* (MSS_PREEMPTIVE_SCHEDULING == TRUE) */
+}
+
+#if (MSS_ISR_FAST_PATH == TRUE)
+/**************************************************************************//**
+*
+* mss_activate_task_from_isr
+*
+* @brief      put task into active state from an ISR without entering critical
+*             section. The task is only marked in mss_isr_ready_task_bits and
+*             taken over by the scheduler afterwards.
+*
+* @param[in]  task_id    task id number
+*
+* @return     -
+*
+* @remark     shall only be called from an ISR. As with mss_activate_task, the
+*             ISR is responsible for waking up the CPU from sleep mode
+*
+******************************************************************************/
+void mss_activate_task_from_isr(uint8_t task_id)
+{
+  // check task id
+  MSS_DEBUG_CHECK(task_id < MSS_NUM_OF_TASKS);
+
+  // mark task as activated with single uninterruptible operation
+  MSS_ATOMIC_OR(mss_isr_ready_task_bits, mss_bitpos_to_bit[task_id]);
+
+#if (MSS_PREEMPTIVE_SCHEDULING == TRUE)
+  if((mss_running_task_id != MSS_INVALID_TASK_ID) &&
+     (task_id < MSS_RUNNING_TASK_PRIO))
+  {
+    // let the software interrupt call the scheduler to do the preemption
+    mss_hal_trigger_sw_int();
+  }
+#endif /* (MSS_PREEMPTIVE_SCHEDULING == TRUE) */
+}
+#endif /* (MSS_ISR_FAST_PATH == TRUE) */
+
+#if (MSS_TASK_USE_MUTEX == TRUE)
+/**************************************************************************//**
+*
+* mss_set_running_prio_int
+*
+* @brief      internal MSS function to change the priority of the running
+*             task when it locks or unlocks a mutex. If the priority is
+*             lowered and a task with higher priority is ready, the running
+*             task is preempted - not reentrant
+*
+* @param[in]  prio       new priority of the running task
+*
+* @return     -
+*
+******************************************************************************/
+void mss_set_running_prio_int(uint8_t prio)
+{
+#if (MSS_PREEMPTIVE_SCHEDULING == TRUE)
+  mss_task_bits_t ready_bits;
+#endif /* (MSS_PREEMPTIVE_SCHEDULING == TRUE) */
+
+  mss_running_task_prio = prio;
+
+#if (MSS_PREEMPTIVE_SCHEDULING == TRUE)
+  ready_bits = mss_ready_task_bits;
+#if (MSS_ISR_FAST_PATH == TRUE)
+  ready_bits |= mss_isr_ready_task_bits;
+#endif /* (MSS_ISR_FAST_PATH == TRUE) */
+
+  // tasks which became ready while the priority was raised
+  if(ready_bits & (mss_task_bits_t)(mss_bitpos_to_bit[prio] - 1))
+  {
+    mss_task_preempted |= mss_bitpos_to_bit[mss_running_task_id];
+    mss_hal_trigger_sw_int();
+  }
+#endif /* (MSS_PREEMPTIVE_SCHEDULING == TRUE) */
+}
+#endif /* (MSS_TASK_USE_MUTEX == TRUE) */
+
 /**************************************************************************//**
 *
 * mss_get_running_task_id
@@ -335,3 +499,75 @@ uint8_t mss_get_running_task_id(void)
 //*****************************************************************************
 // Internal functions
 //*****************************************************************************
+
+#if (MSS_ISR_FAST_PATH == TRUE)
+/**************************************************************************//**
+*
+* mss_isr_ready_merge
+*
+* @brief      take over the tasks activated by ISR fast path into the ready
+*             task bits - not reentrant
+*
+* @param      -
+*
+* @return     -
+*
+******************************************************************************/
+static void mss_isr_ready_merge(void)
+{
+  mss_task_bits_t isr_bits;
+
+  if(mss_isr_ready_task_bits != 0)
+  {
+    // interrupt is disabled, so the bits can be safely taken over
+    isr_bits = mss_isr_ready_task_bits;
+    mss_isr_ready_task_bits = 0;
+
+    // the scheduler is about to run, no need to trigger it
+    mss_set_task_bits(isr_bits);
+  }
+}
+#endif /* (MSS_ISR_FAST_PATH == TRUE) */
+
+/**************************************************************************//**
+*
+* mss_set_task_bits
+*
+* @brief      mark tasks as ready, or as reactivated if they are running or
+*             preempted, and mark the running task as preempted if a task
+*             with higher priority becomes ready - not reentrant
+*
+* @param[in]  task_bits   bits of the tasks to be activated
+*
+* @return     bits of the tasks which are newly marked as ready
+*
+******************************************************************************/
+static mss_task_bits_t mss_set_task_bits(mss_task_bits_t task_bits)
+{
+  mss_task_bits_t busy_bits = 0;
+
+  if(mss_running_task_id != MSS_INVALID_TASK_ID)
+  {
+    busy_bits = mss_bitpos_to_bit[mss_running_task_id];
+
+  #if (MSS_PREEMPTIVE_SCHEDULING == TRUE)
+    if(task_bits &
+       (mss_task_bits_t)(mss_bitpos_to_bit[MSS_RUNNING_TASK_PRIO] - 1))
+    {
+      // a task with higher priority is activated, preempt running task
+      mss_task_preempted |= busy_bits;
+    }
+  #endif /* (MSS_PREEMPTIVE_SCHEDULING == TRUE) */
+  }
+
+#if (MSS_PREEMPTIVE_SCHEDULING == TRUE)
+  busy_bits |= mss_task_preempted;
+#endif /* (MSS_PREEMPTIVE_SCHEDULING == TRUE) */
+
+  // running or preempted tasks shall be re-executed, others become ready
+  mss_task_reactivated |= (task_bits & busy_bits);
+  task_bits &= ~busy_bits;
+  mss_ready_task_bits |= task_bits;
+
+  return task_bits;
+}
@@ -84,6 +84,14 @@
 #include "mss_sema.h"
 #endif
 
+#if (MSS_TASK_USE_MUTEX == TRUE)
+#include "mss_mutex.h"
+#endif
+
+#if (MSS_TASK_USE_RWLOCK == TRUE)
+#include "mss_rwlock.h"
+#endif
+
 #if (MSS_TASK_USE_MQUE == TRUE)
 #include "mss_mque.h"
 #endif
@@ -92,6 +100,22 @@
 #include "mss_mem.h"
 #endif
 
+#if (MSS_TASK_USE_HEAP == TRUE)
+#include "mss_heap.h"
+#endif
+
+#if (MSS_TASK_USE_TOPIC == TRUE)
+#include "mss_topic.h"
+#endif
+
+#if (MSS_TASK_USE_BUF == TRUE)
+#include "mss_buf.h"
+#endif
+
+#if (MSS_TASK_USE_STREAM == TRUE)
+#include "mss_stream.h"
+#endif
+
 /**
  * @defgroup MSS_API  MSS API
  * @{
@@ -218,6 +242,25 @@ void mss_activate_task(uint8_t task_id);
 ******************************************************************************/
 uint8_t mss_get_running_task_id(void);
 
+#if (MSS_ISR_FAST_PATH == TRUE)
+/**************************************************************************//**
+*
+* mss_activate_task_from_isr
+*
+* @brief      put task into active state from an ISR without entering critical
+*             section
+*
+* @param[in]  task_id    task id number
+*
+* @return     -
+*
+* @remark     shall only be called from an ISR. As with mss_activate_task, the
+*             ISR is responsible for waking up the CPU from sleep mode
+*
+******************************************************************************/
+void mss_activate_task_from_isr(uint8_t task_id);
+#endif /* (MSS_ISR_FAST_PATH == TRUE) */
+
 /** @} MSS General API Functtions */
 
 /** @} MSS_General_API */
@@ -0,0 +1,352 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     mss_buf.c
+* 
+* @brief    mcu simple scheduler reference counted buffer module
+*
+* @version  0.2.1
+*
+* @author   Leo Hendrawan
+* 
+* @remark   this will be included in compilation only if MSS_TASK_USE_BUF
+*           defined as TRUE
+* 
+******************************************************************************/
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+#include "mss.h"
+#include "mss_int.h"
+
+#if (MSS_TASK_USE_BUF == TRUE)
+
+//*****************************************************************************
+// Global variables 
+//*****************************************************************************
+
+//*****************************************************************************
+// Macros (defines), data types, static variables
+//*****************************************************************************
+
+// convert buffer data pointer to buffer header and vice versa
+#define BUF_DATA_TO_HDR(data)    ((mss_buf_hdr_t*)(data) - 1)
+#define BUF_HDR_TO_DATA(hdr)     ((void*)((mss_buf_hdr_t*)(hdr) + 1))
+
+#if (MSS_TASK_USE_MQUE == TRUE)
+// size of a message carrying a buffer reference through a message queue,
+// the buffer data pointer is the message data
+#define BUF_MSG_SIZE             (sizeof(mss_mque_msg_t) + sizeof(void*))
+
+// storage and memory block list of the messages
+MSS_MEM_POOL_DEFINE(buf_msg_pool, BUF_MSG_SIZE, MSS_BUF_NUM_OF_MSG,
+                    sizeof(void*));
+static mss_mem_t buf_msg_mem;
+#endif /* (MSS_TASK_USE_MQUE == TRUE) */
+
+//*****************************************************************************
+// Internal function declarations
+//*****************************************************************************
+
+#if (MSS_TASK_USE_MQUE == TRUE)
+static void buf_msg_set(mss_mque_msg_t* msg, void* data);
+static void* buf_msg_get(mss_mque_msg_t* msg);
+#endif /* (MSS_TASK_USE_MQUE == TRUE) */
+
+//*****************************************************************************
+// External functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* mss_buf_alloc
+*
+* @brief      allocate a buffer from a memory block list, the reference count
+*             of the buffer is one
+*
+* @param[in]  pool     memory blocks handle, the block size shall be
+*                      MSS_BUF_BLOCK_SIZE(data size)
+*
+* @return     NULL if failed, otherwise pointer to the buffer data
+*
+******************************************************************************/
+void* mss_buf_alloc(mss_mem_t pool)
+{
+  void* ret = NULL;
+  mss_buf_hdr_t *hdr;
+
+  // check handle
+  MSS_DEBUG_CHECK(pool != MSS_MEM_INVALID_HDL);
+
+  hdr = mss_mem_alloc(pool);
+  if(hdr != NULL)
+  {
+    hdr->pool = pool;
+    hdr->ref_cnt = 1;
+    ret = BUF_HDR_TO_DATA(hdr);
+  }
+
+  return ret;
+}
+
+/**************************************************************************//**
+*
+* mss_buf_ref
+*
+* @brief      add a reference to a buffer
+*
+* @param[in]  data     pointer to the buffer data
+*
+* @return     -
+*
+******************************************************************************/
+void mss_buf_ref(void* data)
+{
+  mss_int_flag_t int_flag;
+
+  // check parameter
+  MSS_DEBUG_CHECK((data != NULL) && (BUF_DATA_TO_HDR(data)->ref_cnt > 0) &&
+                  (BUF_DATA_TO_HDR(data)->ref_cnt < 0xFF));
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  BUF_DATA_TO_HDR(data)->ref_cnt++;
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+}
+
+/**************************************************************************//**
+*
+* mss_buf_unref
+*
+* @brief      release a reference to a buffer. The buffer is returned to its
+*             memory block list with the last reference
+*
+* @param[in]  data     pointer to the buffer data
+*
+* @return     -
+*
+******************************************************************************/
+void mss_buf_unref(void* data)
+{
+  mss_buf_hdr_t *hdr;
+  bool last_ref;
+  mss_int_flag_t int_flag;
+
+  // check parameter
+  MSS_DEBUG_CHECK((data != NULL) && (BUF_DATA_TO_HDR(data)->ref_cnt > 0));
+
+  hdr = BUF_DATA_TO_HDR(data);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  last_ref = (--hdr->ref_cnt == 0);
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+
+  if(last_ref)
+  {
+    // nobody else can see the buffer anymore
+    mss_mem_free(hdr->pool, hdr);
+  }
+}
+
+#if (MSS_TASK_USE_MQUE == TRUE)
+/**************************************************************************//**
+*
+* mss_buf_send
+*
+* @brief      send a buffer to a message queue. The buffer is not copied, the
+*             message queue gets an own reference to the buffer, therefore
+*             the same buffer can be sent to several message queues
+*
+* @param[in]  mque     handle of the message queue
+* @param[in]  data     pointer to the buffer data
+*
+* @return     true if success, false if no message is available
+*             (see MSS_BUF_NUM_OF_MSG) or a full bounded message queue drops
+*             the new message
+*
+* @remark     the message is sent with the lowest priority to priority
+*             ordered message queues. If MSS_MQUE_USE_CAPACITY is TRUE, the
+*             message is sent by mss_mque_try_send, and the reference of a
+*             dropped message is released. Therefore a message queue shall
+*             only get messages of mss_buf_send.
+*
+******************************************************************************/
+bool mss_buf_send(mss_mque_t mque, void* data)
+{
+  bool ret = false;
+  mss_mque_msg_t *msg;
+#if (MSS_MQUE_USE_CAPACITY == TRUE)
+  mss_mque_msg_t *dropped_msg;
+#endif /* (MSS_MQUE_USE_CAPACITY == TRUE) */
+
+  // check parameters
+  MSS_DEBUG_CHECK((mque != MSS_MQUE_INVALID_HDL) && (data != NULL));
+
+  // every message queue needs an own message to link the buffer
+  msg = mss_mem_alloc(buf_msg_mem);
+  if(msg != NULL)
+  {
+    mss_buf_ref(data);
+    buf_msg_set(msg, data);
+  #if (MSS_MQUE_NUM_OF_PRIO > 1)
+    msg->prio = MSS_MQUE_NUM_OF_PRIO - 1;
+  #endif /* (MSS_MQUE_NUM_OF_PRIO > 1) */
+
+  #if (MSS_MQUE_USE_CAPACITY == TRUE)
+    dropped_msg = mss_mque_try_send(mque, msg);
+    ret = (dropped_msg != msg);
+    if(dropped_msg != NULL)
+    {
+      // release the reference of the dropped message
+      mss_buf_unref(buf_msg_get(dropped_msg));
+      mss_mem_free(buf_msg_mem, dropped_msg);
+    }
+  #else
+    mss_mque_send(mque, msg);
+    ret = true;
+  #endif /* (MSS_MQUE_USE_CAPACITY == TRUE) */
+  }
+
+  return ret;
+}
+
+/**************************************************************************//**
+*
+* mss_buf_read
+*
+* @brief      read a buffer sent by mss_buf_send from a message queue. The
+*             reference of the message queue is handed over to the caller,
+*             who shall release it by mss_buf_unref
+*
+* @param[in]  mque     handle of the message queue
+*
+* @return     NULL if no buffer available, otherwise pointer to the buffer
+*             data
+*
+******************************************************************************/
+void* mss_buf_read(mss_mque_t mque)
+{
+  mss_mque_msg_t *msg;
+  void *ret = NULL;
+
+  // check handle
+  MSS_DEBUG_CHECK(mque != MSS_MQUE_INVALID_HDL);
+
+  msg = mss_mque_read(mque);
+  if(msg != NULL)
+  {
+    ret = buf_msg_get(msg);
+    mss_mem_free(buf_msg_mem, msg);
+  }
+
+  return ret;
+}
+#endif /* (MSS_TASK_USE_MQUE == TRUE) */
+
+/**************************************************************************//**
+*
+* mss_buf_init
+*
+* @brief      initialize buffer module
+*
+* @param      -
+*
+* @return     -
+*
+******************************************************************************/
+void mss_buf_init(void)
+{
+#if (MSS_TASK_USE_MQUE == TRUE)
+  buf_msg_mem = mss_mem_create_static(buf_msg_pool, BUF_MSG_SIZE,
+                                      MSS_BUF_NUM_OF_MSG, sizeof(void*));
+  MSS_DEBUG_CHECK(buf_msg_mem != MSS_MEM_INVALID_HDL);
+#endif /* (MSS_TASK_USE_MQUE == TRUE) */
+}
+
+//*****************************************************************************
+// Internal functions
+//*****************************************************************************
+
+#if (MSS_TASK_USE_MQUE == TRUE)
+/**************************************************************************//**
+*
+* buf_msg_set
+*
+* @brief      store the buffer data pointer as message data
+*
+* @param[in]  msg      pointer to the message
+* @param[in]  data     pointer to the buffer data
+*
+* @return     -
+*
+******************************************************************************/
+static void buf_msg_set(mss_mque_msg_t* msg, void* data)
+{
+  uint8_t i;
+
+  // the message data is not aligned for a pointer, copy byte by byte
+  for(i=0 ; i<sizeof(void*) ; i++)
+  {
+    msg->data[i] = ((uint8_t*)&data)[i];
+  }
+}
+
+/**************************************************************************//**
+*
+* buf_msg_get
+*
+* @brief      get the buffer data pointer stored as message data
+*
+* @param[in]  msg      pointer to the message
+*
+* @return     pointer to the buffer data
+*
+******************************************************************************/
+static void* buf_msg_get(mss_mque_msg_t* msg)
+{
+  void* ret;
+  uint8_t i;
+
+  // the message data is not aligned for a pointer, copy byte by byte
+  for(i=0 ; i<sizeof(void*) ; i++)
+  {
+    ((uint8_t*)&ret)[i] = msg->data[i];
+  }
+
+  return ret;
+}
+#endif /* (MSS_TASK_USE_MQUE == TRUE) */
+
+#endif /* (MSS_TASK_USE_BUF == TRUE) */
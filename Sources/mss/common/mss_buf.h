@@ -0,0 +1,199 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     mss_buf.h
+* 
+* @brief    mcu simple scheduler reference counted buffer module header file
+* 
+* @version  0.2.1
+*
+* @author   Leo Hendrawan
+* 
+* @remark   this will be included in compilation only if MSS_TASK_USE_BUF
+*           defined as TRUE
+* 
+******************************************************************************/
+
+#ifndef _MSS_BUF_H_
+#define _MSS_BUF_H_
+
+/**
+ * @ingroup   MSS_API
+ * @defgroup  MSS_Buf_API  MSS Buffer API
+ * @brief     MSS reference counted buffer module API definitions, data
+ *            types, and functions (enabled only if (MSS_TASK_USE_BUF == TRUE))
+ * @{
+ */
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+
+//*****************************************************************************
+// Global variable declarations 
+//*****************************************************************************
+
+
+//*****************************************************************************
+// Macros (defines) and data types 
+//*****************************************************************************
+
+/** mss_buf_hdr_t
+ *  header in front of the data of every buffer
+ */
+typedef struct {
+  /** memory block list of the buffer */
+  mss_mem_t pool;
+  /** number of references to the buffer */
+  uint8_t ref_cnt;
+}mss_buf_hdr_t;
+
+/** MSS_BUF_BLOCK_SIZE
+ *  block size of a memory block list for buffers with data_size bytes
+ */
+#define MSS_BUF_BLOCK_SIZE(data_size)    (sizeof(mss_buf_hdr_t) + (data_size))
+
+//*****************************************************************************
+// External function declarations
+//*****************************************************************************
+
+/**
+ * @name MSS Buffer API Functions
+ * @{
+ */
+
+/**************************************************************************//**
+*
+* mss_buf_alloc
+*
+* @brief      allocate a buffer from a memory block list, the reference count
+*             of the buffer is one
+*
+* @param[in]  pool     memory blocks handle, the block size shall be
+*                      MSS_BUF_BLOCK_SIZE(data size)
+*
+* @return     NULL if failed, otherwise pointer to the buffer data
+*
+******************************************************************************/
+void* mss_buf_alloc(mss_mem_t pool);
+
+/**************************************************************************//**
+*
+* mss_buf_ref
+*
+* @brief      add a reference to a buffer
+*
+* @param[in]  data     pointer to the buffer data
+*
+* @return     -
+*
+******************************************************************************/
+void mss_buf_ref(void* data);
+
+/**************************************************************************//**
+*
+* mss_buf_unref
+*
+* @brief      release a reference to a buffer. The buffer is returned to its
+*             memory block list with the last reference
+*
+* @param[in]  data     pointer to the buffer data
+*
+* @return     -
+*
+******************************************************************************/
+void mss_buf_unref(void* data);
+
+#if (MSS_TASK_USE_MQUE == TRUE)
+/**************************************************************************//**
+*
+* mss_buf_send
+*
+* @brief      send a buffer to a message queue. The buffer is not copied, the
+*             message queue gets an own reference to the buffer, therefore
+*             the same buffer can be sent to several message queues
+*
+* @param[in]  mque     handle of the message queue
+* @param[in]  data     pointer to the buffer data
+*
+* @return     true if success, false if no message is available
+*             (see MSS_BUF_NUM_OF_MSG) or a full bounded message queue drops
+*             the new message
+*
+* @remark     the message is sent with the lowest priority to priority
+*             ordered message queues. If MSS_MQUE_USE_CAPACITY is TRUE, the
+*             message is sent by mss_mque_try_send, and the reference of a
+*             dropped message is released. Therefore a message queue shall
+*             only get messages of mss_buf_send.
+*
+******************************************************************************/
+bool mss_buf_send(mss_mque_t mque, void* data);
+
+/**************************************************************************//**
+*
+* mss_buf_read
+*
+* @brief      read a buffer sent by mss_buf_send from a message queue. The
+*             reference of the message queue is handed over to the caller,
+*             who shall release it by mss_buf_unref
+*
+* @param[in]  mque     handle of the message queue
+*
+* @return     NULL if no buffer available, otherwise pointer to the buffer
+*             data
+*
+******************************************************************************/
+void* mss_buf_read(mss_mque_t mque);
+
+/**************************************************************************//**
+*
+* MSS_BUF_WAIT
+*
+* @brief      macro (blocking) function which waits until a buffer is sent
+*             to a message queue
+*
+* @param[in]  mque      handle of the message queue
+* @param[out] data      buffer for storing the pointer to the buffer data
+* @param[in]  context   mss task context
+*
+* @return     -
+*
+******************************************************************************/
+#define MSS_BUF_WAIT(mque, data, context)                \
+        do{while((data = mss_buf_read(mque)) == NULL)    \
+           MSS_RETURN(context);}while(0)
+#endif /* (MSS_TASK_USE_MQUE == TRUE) */
+
+/** @} MSS Buffer API Functions */
+
+/** @} MSS_Buf_API */
+
+#endif /* _MSS_BUF_H_*/
@@ -64,10 +64,60 @@
  */
 static mss_event_t task_event[MSS_NUM_OF_TASKS];
 
+/** task_wait_mask
+ *  event bits a task is waiting for with MSS_EVENT_WAIT_ALL/ANY, zero if
+ *  the task shall be activated on any event
+ */
+static mss_event_t task_wait_mask[MSS_NUM_OF_TASKS];
+
+/** task_wait_all
+ *  flag bits of tasks waiting for all bits of task_wait_mask
+ */
+static mss_task_bits_t task_wait_all = 0;
+
+#if (MSS_MAX_NUM_OF_EVENT_GROUP > 0)
+/** mss_event_group_tbl_t
+ *  mss event group table data type
+ */
+struct mss_event_group_tbl_t {
+  mss_task_bits_t subscribers;
+};
+
+// number of created event groups
+static uint8_t num_of_event_group = 0;
+
+// event group table
+static struct mss_event_group_tbl_t event_group_tbl[MSS_MAX_NUM_OF_EVENT_GROUP];
+#endif /* (MSS_MAX_NUM_OF_EVENT_GROUP > 0) */
+
+#if (MSS_EVENT_USE_COUNTER == TRUE)
+// number of event bits in mss_event_t
+#define EVENT_NUM_OF_BITS          (sizeof(mss_event_t)*8)
+
+// maximum number of pending occurrences of a single event bit
+#define EVENT_CNT_MAX              (0xFF)
+
+// maximum value of the lost event occurrence counter
+#define EVENT_OVF_CNT_MAX          (0xFFFF)
+
+/** task_event_cnt
+ *  number of pending occurrences of every event bit of every task
+ */
+static uint8_t task_event_cnt[MSS_NUM_OF_TASKS][EVENT_NUM_OF_BITS];
+
+/** task_event_ovf
+ *  number of event occurrences of every task lost due to a full counter
+ */
+static uint16_t task_event_ovf[MSS_NUM_OF_TASKS];
+#endif /* (MSS_EVENT_USE_COUNTER == TRUE) */
+
 //*****************************************************************************
 // Internal function declarations
 //*****************************************************************************
 
+static void event_add(uint8_t task_id, mss_event_t event);
+static mss_event_t event_consume(uint8_t task_id, mss_event_t mask);
+static bool event_cond_met(uint8_t task_id);
 
 //*****************************************************************************
 // External functions
@@ -87,11 +137,24 @@ static mss_event_t task_event[MSS_NUM_OF_TASKS];
 void mss_event_init(void)
 {
   uint8_t i;
+#if (MSS_EVENT_USE_COUNTER == TRUE)
+  uint8_t j;
+#endif /* (MSS_EVENT_USE_COUNTER == TRUE) */
 
   // initialize the task control blocks
   for(i=0 ; i<MSS_NUM_OF_TASKS ; i++)
   {
     task_event[i] = 0;
+    task_wait_mask[i] = 0;
+
+  #if (MSS_EVENT_USE_COUNTER == TRUE)
+    // reset event occurrence counters
+    for(j=0 ; j<EVENT_NUM_OF_BITS ; j++)
+    {
+      task_event_cnt[i][j] = 0;
+    }
+    task_event_ovf[i] = 0;
+  #endif /* (MSS_EVENT_USE_COUNTER == TRUE) */
   }
 }
 
@@ -116,13 +179,52 @@ void mss_event_set(uint8_t task_id, mss_event_t event)
 
   MSS_ENTER_CRITICAL_SECTION(int_flag);
   
-  // set task event and activate task
-  task_event[task_id] |= event;
-  mss_activate_task_int(task_id);
+  // set task event and activate task if its wait condition is met
+  event_add(task_id, event);
+  if(event_cond_met(task_id))
+  {
+    mss_activate_task_int(task_id);
+  }
   
   MSS_LEAVE_CRITICAL_SECTION(int_flag);
 }
 
+#if (MSS_ISR_FAST_PATH == TRUE)
+/**************************************************************************//**
+*
+* mss_event_set_from_isr
+*
+* @brief      set an event to a mss task from an ISR without entering critical
+*             section (will activate the task)
+*
+* @param[in]  task_id    task id number
+* @param[in]  event      event to be set
+*
+* @return     -
+*
+* @remark     shall only be called from an ISR. The wait condition of
+*             MSS_EVENT_WAIT_ALL/ANY is not checked, the task is always
+*             activated and checks its condition again. If
+*             MSS_EVENT_USE_COUNTER is TRUE the event counters can not be
+*             updated atomically, and this function falls back to
+*             mss_event_set
+*
+******************************************************************************/
+void mss_event_set_from_isr(uint8_t task_id, mss_event_t event)
+{
+#if (MSS_EVENT_USE_COUNTER == TRUE)
+  mss_event_set(task_id, event);
+#else
+  // check task id
+  MSS_DEBUG_CHECK(task_id < MSS_NUM_OF_TASKS);
+
+  // set task event and activate task
+  MSS_ATOMIC_OR(task_event[task_id], event);
+  mss_activate_task_from_isr(task_id);
+#endif /* (MSS_EVENT_USE_COUNTER == TRUE) */
+}
+#endif /* (MSS_ISR_FAST_PATH == TRUE) */
+
 /**************************************************************************//**
 *
 * mss_event_get
@@ -134,6 +236,11 @@ void mss_event_set(uint8_t task_id, mss_event_t event)
 *
 * @return     event bits of the running task id
 *
+* @remark     if MSS_EVENT_USE_COUNTER is TRUE, only one occurrence of every
+*             returned event bit is consumed. Event bits with more pending
+*             occurrences stay set for the next call, and the running task
+*             is activated again to get them
+*
 ******************************************************************************/
 mss_event_t mss_event_get(void)
 {
@@ -143,17 +250,364 @@ mss_event_t mss_event_get(void)
   MSS_ENTER_CRITICAL_SECTION(int_flag);
 
   // copy event to return value and clear event variable
-  ret_event = task_event[mss_running_task_id];
-  task_event[mss_running_task_id] = 0;
+  ret_event = event_consume(mss_running_task_id, (mss_event_t)~0);
+
+  // task shall be activated again on any event
+  task_wait_mask[mss_running_task_id] = 0;
+
+#if (MSS_EVENT_USE_COUNTER == TRUE)
+  // occurrences are still pending, run the task again to get them
+  if(task_event[mss_running_task_id] != 0)
+  {
+    mss_activate_task_int(mss_running_task_id);
+  }
+#endif /* (MSS_EVENT_USE_COUNTER == TRUE) */
 
   MSS_LEAVE_CRITICAL_SECTION(int_flag);
 
   return ret_event;
 }
 
+/**************************************************************************//**
+*
+* mss_event_wait_cond
+*
+* @brief      check the wait condition of the running task and consume only
+*             the masked event bits if it is met. If it is not met, the
+*             condition is saved and the task will only be activated by
+*             mss_event_set once the condition is met
+*
+* @param[in]  mask       event bits to wait for (shall not be zero)
+* @param[in]  wait_all   if true all event bits in mask shall be set, if
+*                        false at least one of them
+*
+* @return     the consumed event bits, zero if the condition is not met
+*
+******************************************************************************/
+mss_event_t mss_event_wait_cond(mss_event_t mask, bool wait_all)
+{
+  mss_event_t ret_event = 0;
+  mss_task_bits_t task_bit;
+  mss_int_flag_t int_flag;
+
+  // check mask
+  MSS_DEBUG_CHECK(mask != 0);
+
+  // turn running task id into bit position
+  task_bit = mss_bitpos_to_bit[mss_running_task_id];
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  // save wait condition
+  task_wait_mask[mss_running_task_id] = mask;
+  if(wait_all)
+  {
+    task_wait_all |= task_bit;
+  }
+  else
+  {
+    task_wait_all &= ~task_bit;
+  }
+
+  if(event_cond_met(mss_running_task_id))
+  {
+    // consume only the masked event bits
+    ret_event = event_consume(mss_running_task_id, mask);
+
+  #if (MSS_EVENT_USE_COUNTER == TRUE)
+    // occurrences meeting the condition are still pending, run the task
+    // again to get them
+    if(event_cond_met(mss_running_task_id))
+    {
+      mss_activate_task_int(mss_running_task_id);
+    }
+  #endif /* (MSS_EVENT_USE_COUNTER == TRUE) */
+
+    // remove the wait condition
+    task_wait_mask[mss_running_task_id] = 0;
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+
+  return ret_event;
+}
+
+#if (MSS_EVENT_USE_COUNTER == TRUE)
+/**************************************************************************//**
+*
+* mss_event_get_overflow
+*
+* @brief      get the number of event occurrences of a task which have been
+*             lost because the occurrence counter of the event bit was full
+*
+* @param[in]  task_id    task id number
+*
+* @return     number of lost event occurrences (saturates at 0xFFFF)
+*
+******************************************************************************/
+uint16_t mss_event_get_overflow(uint8_t task_id)
+{
+  uint16_t ret;
+  mss_int_flag_t int_flag;
+
+  // check task id
+  MSS_DEBUG_CHECK(task_id < MSS_NUM_OF_TASKS);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  ret = task_event_ovf[task_id];
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+
+  return ret;
+}
+#endif /* (MSS_EVENT_USE_COUNTER == TRUE) */
+
+#if (MSS_MAX_NUM_OF_EVENT_GROUP > 0)
+/**************************************************************************//**
+*
+* mss_event_group_create
+*
+* @brief      create a new event group without any subscriber task
+*
+* @param      -
+*
+* @return     handle to created event group, MSS_EVENT_GROUP_INVALID_HDL if
+*             failure
+*
+******************************************************************************/
+mss_event_group_t mss_event_group_create(void)
+{
+  mss_event_group_t ret_hdl = MSS_EVENT_GROUP_INVALID_HDL;
+
+  // check if there is a free event group block
+  if(num_of_event_group < MSS_MAX_NUM_OF_EVENT_GROUP)
+  {
+    // initialize subscriber list
+    event_group_tbl[num_of_event_group].subscribers = 0;
+
+    // return handle and increment number of event group block
+    ret_hdl = &event_group_tbl[num_of_event_group++];
+  }
+
+  return ret_hdl;
+}
+
+/**************************************************************************//**
+*
+* mss_event_group_subscribe
+*
+* @brief      add a task into the subscriber list of an event group
+*
+* @param[in]  hdl        event group handle
+* @param[in]  task_id    task id number
+*
+* @return     -
+*
+******************************************************************************/
+void mss_event_group_subscribe(mss_event_group_t hdl, uint8_t task_id)
+{
+  mss_int_flag_t int_flag;
+
+  // check parameters
+  MSS_DEBUG_CHECK((hdl != MSS_EVENT_GROUP_INVALID_HDL) &&
+                  (task_id < MSS_NUM_OF_TASKS));
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  hdl->subscribers |= mss_bitpos_to_bit[task_id];
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+}
+
+/**************************************************************************//**
+*
+* mss_event_group_unsubscribe
+*
+* @brief      remove a task from the subscriber list of an event group
+*
+* @param[in]  hdl        event group handle
+* @param[in]  task_id    task id number
+*
+* @return     -
+*
+******************************************************************************/
+void mss_event_group_unsubscribe(mss_event_group_t hdl, uint8_t task_id)
+{
+  mss_int_flag_t int_flag;
+
+  // check parameters
+  MSS_DEBUG_CHECK((hdl != MSS_EVENT_GROUP_INVALID_HDL) &&
+                  (task_id < MSS_NUM_OF_TASKS));
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  hdl->subscribers &= ~mss_bitpos_to_bit[task_id];
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+}
+
+/**************************************************************************//**
+*
+* mss_event_group_set
+*
+* @brief      set an event to all subscriber tasks of an event group (will
+*             activate the tasks) within a single critical section
+*
+* @param[in]  hdl        event group handle
+* @param[in]  event      event to be set
+*
+* @return     -
+*
+******************************************************************************/
+void mss_event_group_set(mss_event_group_t hdl, mss_event_t event)
+{
+  mss_task_bits_t subscribers, activated = 0;
+  uint8_t task_id;
+  mss_int_flag_t int_flag;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_EVENT_GROUP_INVALID_HDL);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  // set event of every subscriber task
+  for(task_id=0, subscribers=hdl->subscribers ; subscribers != 0 ;
+      task_id++, subscribers >>= 1)
+  {
+    if(subscribers & 0x01)
+    {
+      event_add(task_id, event);
+
+      // collect tasks whose wait condition is met
+      if(event_cond_met(task_id))
+      {
+        activated |= mss_bitpos_to_bit[task_id];
+      }
+    }
+  }
+
+  // activate all collected tasks at once
+  mss_activate_tasks_int(activated);
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+}
+#endif /* (MSS_MAX_NUM_OF_EVENT_GROUP > 0) */
+
 //*****************************************************************************
 // Internal functions
 //*****************************************************************************
 
+/**************************************************************************//**
+*
+* event_add
+*
+* @brief      add event bits to a task - not reentrant
+*
+* @param[in]  task_id    task id number
+* @param[in]  event      event bits to be added
+*
+* @return     -
+*
+******************************************************************************/
+static void event_add(uint8_t task_id, mss_event_t event)
+{
+#if (MSS_EVENT_USE_COUNTER == TRUE)
+  mss_event_t bits;
+  uint8_t i;
+
+  // count one occurrence for every event bit set
+  for(i=0, bits=event ; bits != 0 ; i++, bits >>= 1)
+  {
+    if(bits & 0x01)
+    {
+      if(task_event_cnt[task_id][i] < EVENT_CNT_MAX)
+      {
+        task_event_cnt[task_id][i]++;
+      }
+      else if(task_event_ovf[task_id] < EVENT_OVF_CNT_MAX)
+      {
+        // counter is full, the occurrence is lost
+        task_event_ovf[task_id]++;
+      }
+    }
+  }
+#endif /* (MSS_EVENT_USE_COUNTER == TRUE) */
+
+  // mark event bits as pending
+  task_event[task_id] |= event;
+}
+
+/**************************************************************************//**
+*
+* event_consume
+*
+* @brief      consume pending event bits of a task - not reentrant
+*
+* @param[in]  task_id    task id number
+* @param[in]  mask       event bits to be consumed
+*
+* @return     the pending event bits which are consumed
+*
+******************************************************************************/
+static mss_event_t event_consume(uint8_t task_id, mss_event_t mask)
+{
+  mss_event_t ret_event;
+#if (MSS_EVENT_USE_COUNTER == TRUE)
+  mss_event_t bits;
+  uint8_t i;
+#endif /* (MSS_EVENT_USE_COUNTER == TRUE) */
+
+  ret_event = task_event[task_id] & mask;
+
+#if (MSS_EVENT_USE_COUNTER == TRUE)
+  // consume one occurrence of every event bit, the bit is cleared only if
+  // there is no more pending occurrence
+  for(i=0, bits=ret_event ; bits != 0 ; i++, bits >>= 1)
+  {
+    if((bits & 0x01) && (--task_event_cnt[task_id][i] == 0))
+    {
+      task_event[task_id] &= ~((mss_event_t)1 << i);
+    }
+  }
+#else
+  task_event[task_id] &= ~ret_event;
+#endif /* (MSS_EVENT_USE_COUNTER == TRUE) */
+
+  return ret_event;
+}
+
+/**************************************************************************//**
+*
+* event_cond_met
+*
+* @brief      check whether the wait condition of a task is met - not
+*             reentrant
+*
+* @param[in]  task_id    task id number
+*
+* @return     true if the task has no wait condition or the condition is met
+*
+******************************************************************************/
+static bool event_cond_met(uint8_t task_id)
+{
+  mss_event_t mask = task_wait_mask[task_id];
+  bool ret = true;
+
+  if(mask != 0)
+  {
+    if(task_wait_all & mss_bitpos_to_bit[task_id])
+    {
+      ret = ((task_event[task_id] & mask) == mask);
+    }
+    else
+    {
+      ret = ((task_event[task_id] & mask) != 0);
+    }
+  }
+
+  return ret;
+}
+
 
 #endif /* (MSS_TASK_USE_EVENT == TRUE) */
@@ -66,6 +66,24 @@
 // Macros (defines) and data types 
 //*****************************************************************************
 
+#if (MSS_MAX_NUM_OF_EVENT_GROUP > 0)
+/**
+ * @name MSS Event Group handle
+ * @{
+ */
+
+/** mss_event_group_t
+ *  mss event group handle data type
+ */
+typedef struct mss_event_group_tbl_t*   mss_event_group_t;
+
+/** MSS_EVENT_GROUP_INVALID_HDL
+ *  invalid event group handle
+ */
+#define MSS_EVENT_GROUP_INVALID_HDL      ((mss_event_group_t)NULL)
+
+/** @} MSS Event Group handle */
+#endif /* (MSS_MAX_NUM_OF_EVENT_GROUP > 0) */
 
 //*****************************************************************************
 // External function declarations
@@ -90,6 +108,30 @@
 ******************************************************************************/
 void mss_event_set(uint8_t task_id, mss_event_t event);
 
+#if (MSS_ISR_FAST_PATH == TRUE)
+/**************************************************************************//**
+*
+* mss_event_set_from_isr
+*
+* @brief      set an event to a mss task from an ISR without entering critical
+*             section (will activate the task)
+*
+* @param[in]  task_id    task id number
+* @param[in]  event      event to be set
+*
+* @return     -
+*
+* @remark     shall only be called from an ISR. The wait condition of
+*             MSS_EVENT_WAIT_ALL/ANY is not checked, the task is always
+*             activated and checks its condition again. If
+*             MSS_EVENT_USE_COUNTER is TRUE the event counters can not be
+*             updated atomically, and this function falls back to
+*             mss_event_set
+*
+******************************************************************************/
+void mss_event_set_from_isr(uint8_t task_id, mss_event_t event);
+#endif /* (MSS_ISR_FAST_PATH == TRUE) */
+
 /**************************************************************************//**
 *
 * mss_event_get
@@ -101,9 +143,107 @@ void mss_event_set(uint8_t task_id, mss_event_t event);
 *
 * @return     event bits of the running task id
 *
+* @remark     if MSS_EVENT_USE_COUNTER is TRUE, only one occurrence of every
+*             returned event bit is consumed. Event bits with more pending
+*             occurrences stay set for the next call, and the running task
+*             is activated again to get them
+*
 ******************************************************************************/
 mss_event_t mss_event_get(void);
 
+/**************************************************************************//**
+*
+* mss_event_wait_cond
+*
+* @brief      check the wait condition of the running task and consume only
+*             the masked event bits if it is met. If it is not met, the
+*             condition is saved and the task will only be activated by
+*             mss_event_set once the condition is met
+*
+* @param[in]  mask       event bits to wait for (shall not be zero)
+* @param[in]  wait_all   if true all event bits in mask shall be set, if
+*                        false at least one of them
+*
+* @return     the consumed event bits, zero if the condition is not met
+*
+******************************************************************************/
+mss_event_t mss_event_wait_cond(mss_event_t mask, bool wait_all);
+
+#if (MSS_EVENT_USE_COUNTER == TRUE)
+/**************************************************************************//**
+*
+* mss_event_get_overflow
+*
+* @brief      get the number of event occurrences of a task which have been
+*             lost because the occurrence counter of the event bit was full
+*
+* @param[in]  task_id    task id number
+*
+* @return     number of lost event occurrences (saturates at 0xFFFF)
+*
+******************************************************************************/
+uint16_t mss_event_get_overflow(uint8_t task_id);
+#endif /* (MSS_EVENT_USE_COUNTER == TRUE) */
+
+#if (MSS_MAX_NUM_OF_EVENT_GROUP > 0)
+/**************************************************************************//**
+*
+* mss_event_group_create
+*
+* @brief      create a new event group without any subscriber task
+*
+* @param      -
+*
+* @return     handle to created event group, MSS_EVENT_GROUP_INVALID_HDL if
+*             failure
+*
+******************************************************************************/
+mss_event_group_t mss_event_group_create(void);
+
+/**************************************************************************//**
+*
+* mss_event_group_subscribe
+*
+* @brief      add a task into the subscriber list of an event group
+*
+* @param[in]  hdl        event group handle
+* @param[in]  task_id    task id number
+*
+* @return     -
+*
+******************************************************************************/
+void mss_event_group_subscribe(mss_event_group_t hdl, uint8_t task_id);
+
+/**************************************************************************//**
+*
+* mss_event_group_unsubscribe
+*
+* @brief      remove a task from the subscriber list of an event group
+*
+* @param[in]  hdl        event group handle
+* @param[in]  task_id    task id number
+*
+* @return     -
+*
+******************************************************************************/
+void mss_event_group_unsubscribe(mss_event_group_t hdl, uint8_t task_id);
+
+/**************************************************************************//**
+*
+* mss_event_group_set
+*
+* @brief      set an event to all subscriber tasks of an event group (will
+*             activate the tasks) within a single critical section
+*
+* @param[in]  hdl        event group handle
+* @param[in]  event      event to be set
+*
+* @return     -
+*
+******************************************************************************/
+void mss_event_group_set(mss_event_group_t hdl, mss_event_t event);
+#endif /* (MSS_MAX_NUM_OF_EVENT_GROUP > 0) */
+
 /**************************************************************************//**
 *
 * MSS_EVENT_WAIT
@@ -121,6 +261,74 @@ mss_event_t mss_event_get(void);
         do{while((event = mss_event_get()) == 0) \
         	MSS_RETURN(context);}while(0)
 
+#if (MSS_TASK_USE_TIMEOUT == TRUE)
+/**************************************************************************//**
+*
+* MSS_EVENT_WAIT_TIMEOUT
+*
+* @brief      macro (blocking) function which waits until a task get at least
+*             one event bit get set, or until the timeout expires
+*
+* @param[out] event     buffer for storing event bits, zero if timeout
+* @param[in]  tick      timeout in timer ticks (shall be greater than zero,
+*                       an invalid value times out immediately)
+* @param[in]  context   mss task context
+*
+* @return     -
+*
+******************************************************************************/
+#define MSS_EVENT_WAIT_TIMEOUT(event, tick, context)  \
+        do{mss_timeout_start(tick);                   \
+           while((event = mss_event_get()) == 0)      \
+           {                                          \
+             if(mss_timeout_check_expired())          \
+             {                                        \
+               break;                                 \
+             }                                        \
+             MSS_RETURN(context);                     \
+           }                                          \
+           mss_timeout_stop();}while(0)
+#endif /* (MSS_TASK_USE_TIMEOUT == TRUE) */
+
+/**************************************************************************//**
+*
+* MSS_EVENT_WAIT_ALL
+*
+* @brief      macro (blocking) function which waits until all event bits in
+*             mask are set. Only the masked event bits are consumed, and the
+*             task is not activated by events which do not fulfill the
+*             condition
+*
+* @param[in]  mask      event bits to wait for
+* @param[out] event     buffer for storing the consumed event bits
+* @param[in]  context   mss task context
+*
+* @return     -
+*
+******************************************************************************/
+#define MSS_EVENT_WAIT_ALL(mask, event, context)                 \
+        do{while((event = mss_event_wait_cond(mask, true)) == 0) \
+           MSS_RETURN(context);}while(0)
+
+/**************************************************************************//**
+*
+* MSS_EVENT_WAIT_ANY
+*
+* @brief      macro (blocking) function which waits until at least one event
+*             bit in mask is set. Only the masked event bits are consumed,
+*             and the task is not activated by events outside the mask
+*
+* @param[in]  mask      event bits to wait for
+* @param[out] event     buffer for storing the consumed event bits
+* @param[in]  context   mss task context
+*
+* @return     -
+*
+******************************************************************************/
+#define MSS_EVENT_WAIT_ANY(mask, event, context)                  \
+        do{while((event = mss_event_wait_cond(mask, false)) == 0) \
+           MSS_RETURN(context);}while(0)
+
 /** @} MSS Event API Functions */
 
 /** @} MSS_Event_API */
@@ -0,0 +1,277 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     mss_heap.c
+* 
+* @brief    mcu simple scheduler heap (multi size class memory) module
+*
+* @version  0.2.1
+*
+* @author   Leo Hendrawan
+* 
+* @remark   this will be included in compilation only if MSS_TASK_USE_HEAP
+*           defined as TRUE
+* 
+******************************************************************************/
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+#include "mss.h"
+#include "mss_int.h"
+
+#if (MSS_TASK_USE_HEAP == TRUE)
+
+//*****************************************************************************
+// Global variables 
+//*****************************************************************************
+
+//*****************************************************************************
+// Macros (defines), data types, static variables
+//*****************************************************************************
+
+/** heap_class_t
+ *  heap size class data type
+ */
+typedef struct {
+  mss_mem_t mem;
+  uint16_t block_size;
+} heap_class_t;
+
+// number of granules covered by the size class lookup table
+#define HEAP_NUM_OF_GRANULES   ((MSS_HEAP_MAX_BLOCK_SIZE + MSS_HEAP_GRANULE - 1)\
+                                / MSS_HEAP_GRANULE)
+
+// number of added size classes
+static uint8_t num_of_class = 0;
+
+// size class table, in ascending order of block size
+static heap_class_t class_tbl[MSS_HEAP_NUM_OF_CLASS];
+
+// smallest fitting size class for every granule of requested size
+static uint8_t class_lookup[HEAP_NUM_OF_GRANULES];
+
+//*****************************************************************************
+// Internal function declarations
+//*****************************************************************************
+
+static bool heap_add_class(void* buf, uint16_t block_size,
+                           uint16_t num_of_blocks);
+
+//*****************************************************************************
+// External functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* mss_heap_add_class
+*
+* @brief      add a size class to the heap, a memory block list of the MSS
+*             memory module is created for the size class. The size classes
+*             shall be added in ascending order of block size
+*
+* @param[in]  block_size      size of a memory block of the size class in
+*                             bytes, rounded up to MSS_HEAP_GRANULE
+* @param[in]  num_of_blocks   number of memory blocks of the size class
+*
+* @return     true if success, false if no more size class can be added or
+*             the memory block list can not be created
+*
+******************************************************************************/
+bool mss_heap_add_class(uint16_t block_size, uint16_t num_of_blocks)
+{
+  return heap_add_class(NULL, block_size, num_of_blocks);
+}
+
+/**************************************************************************//**
+*
+* mss_heap_add_class_static
+*
+* @brief      add a size class to the heap like mss_heap_add_class, but the
+*             memory blocks of the size class are placed in a memory area
+*             given by the caller
+*
+* @param[in]  buf             pointer to the memory area, shall have at least
+*                             MSS_HEAP_CLASS_POOL_SIZE(block_size,
+*                             num_of_blocks) bytes (see
+*                             MSS_HEAP_CLASS_POOL_DEFINE)
+* @param[in]  block_size      size of a memory block of the size class in
+*                             bytes, rounded up to MSS_HEAP_GRANULE
+* @param[in]  num_of_blocks   number of memory blocks of the size class
+*
+* @return     true if success, false if no more size class can be added or
+*             the memory block list can not be created
+*
+******************************************************************************/
+bool mss_heap_add_class_static(void* buf, uint16_t block_size,
+                               uint16_t num_of_blocks)
+{
+  // check parameters
+  MSS_DEBUG_CHECK(buf != NULL);
+
+  return heap_add_class(buf, block_size, num_of_blocks);
+}
+
+/**************************************************************************//**
+*
+* mss_heap_alloc
+*
+* @brief      allocate a memory block from the smallest size class fitting
+*             the requested size. If the size class is exhausted, the next
+*             larger size class is used
+*
+* @param[in]  size     requested size in bytes
+*
+* @return     NULL if failed, otherwise pointer to the allocated memory block
+*
+******************************************************************************/
+void* mss_heap_alloc(uint16_t size)
+{
+  void* ret = NULL;
+  uint8_t class_idx;
+
+  // check if there is a fitting size class
+  if((size > 0) && (num_of_class > 0) &&
+     (size <= class_tbl[num_of_class-1].block_size))
+  {
+    // try the smallest fitting class first, then the larger ones
+    for(class_idx = class_lookup[(size - 1) / MSS_HEAP_GRANULE] ;
+        (ret == NULL) && (class_idx < num_of_class) ; class_idx++)
+    {
+      ret = mss_mem_alloc(class_tbl[class_idx].mem);
+    }
+  }
+
+  return ret;
+}
+
+/**************************************************************************//**
+*
+* mss_heap_free
+*
+* @brief      free a memory block allocated by mss_heap_alloc
+*
+* @param[in]  data     pointer of the data to be freed
+*
+* @return     -
+*
+******************************************************************************/
+void mss_heap_free(void* data)
+{
+  uint8_t class_idx;
+
+  // search the size class owning the memory block
+  for(class_idx = 0 ; (class_idx < num_of_class) &&
+      (mss_mem_check_block(class_tbl[class_idx].mem, data) == false) ;
+      class_idx++);
+
+  // the memory block shall belong to the heap
+  MSS_DEBUG_CHECK(class_idx < num_of_class);
+
+  if(class_idx < num_of_class)
+  {
+    mss_mem_free(class_tbl[class_idx].mem, data);
+  }
+}
+
+//*****************************************************************************
+// Internal functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* heap_add_class
+*
+* @brief      add a size class to the heap
+*
+* @param[in]  buf             pointer to the memory area of the memory blocks,
+*                             NULL to allocate it dynamically
+* @param[in]  block_size      size of a memory block of the size class in
+*                             bytes, rounded up to MSS_HEAP_GRANULE
+* @param[in]  num_of_blocks   number of memory blocks of the size class
+*
+* @return     true if success, otherwise false
+*
+******************************************************************************/
+static bool heap_add_class(void* buf, uint16_t block_size,
+                           uint16_t num_of_blocks)
+{
+  bool ret = false;
+  uint16_t granule, last_granule = 0;
+  mss_mem_t mem;
+
+  // check parameters
+  MSS_DEBUG_CHECK((block_size > 0) &&
+                  (block_size <= MSS_HEAP_MAX_BLOCK_SIZE));
+
+  // round up block size to granule
+  granule = (block_size + MSS_HEAP_GRANULE - 1) / MSS_HEAP_GRANULE;
+
+  if(num_of_class > 0)
+  {
+    last_granule = class_tbl[num_of_class-1].block_size / MSS_HEAP_GRANULE;
+  }
+
+  // check if there is a free size class, and the order is ascending
+  if((num_of_class < MSS_HEAP_NUM_OF_CLASS) && (granule > last_granule))
+  {
+    if(buf == NULL)
+    {
+      mem = mss_mem_create(granule * MSS_HEAP_GRANULE, num_of_blocks);
+    }
+    else
+    {
+      mem = mss_mem_create_static(buf, granule * MSS_HEAP_GRANULE,
+                                  num_of_blocks, sizeof(void*));
+    }
+
+    // the size class is added only with its memory block list
+    if(mem != MSS_MEM_INVALID_HDL)
+    {
+      class_tbl[num_of_class].mem = mem;
+      class_tbl[num_of_class].block_size = granule * MSS_HEAP_GRANULE;
+
+      // the new class is the smallest fitting class for the granules
+      // above the previous class
+      while(last_granule < granule)
+      {
+        class_lookup[last_granule++] = num_of_class;
+      }
+
+      num_of_class++;
+      ret = true;
+    }
+  }
+
+  return ret;
+}
+
+#endif /* (MSS_TASK_USE_HEAP == TRUE) */
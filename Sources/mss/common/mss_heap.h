@@ -0,0 +1,166 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     mss_heap.h
+* 
+* @brief    mcu simple scheduler heap (multi size class memory) module header
+*           file
+* 
+* @version  0.2.1
+*
+* @author   Leo Hendrawan
+* 
+* @remark   this will be included in compilation only if MSS_TASK_USE_HEAP
+*           defined as TRUE
+* 
+******************************************************************************/
+
+#ifndef _MSS_HEAP_H_
+#define _MSS_HEAP_H_
+
+/**
+ * @ingroup   MSS_API
+ * @defgroup  MSS_Heap_API  MSS Heap API
+ * @brief     MSS heap module API definitions, data types, and functions
+ *            (enabled only if (MSS_TASK_USE_HEAP == TRUE))
+ * @{
+ */
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+
+//*****************************************************************************
+// Global variable declarations 
+//*****************************************************************************
+
+
+//*****************************************************************************
+// Macros (defines) and data types 
+//*****************************************************************************
+
+/** MSS_HEAP_CLASS_POOL_SIZE
+ *  size of the memory area needed by mss_heap_add_class_static in bytes
+ */
+#define MSS_HEAP_CLASS_POOL_SIZE(block_size, num_of_blocks)                \
+        MSS_MEM_POOL_SIZE((((block_size) + MSS_HEAP_GRANULE - 1) /         \
+                           MSS_HEAP_GRANULE) * MSS_HEAP_GRANULE,           \
+                          num_of_blocks, sizeof(void*))
+
+/** MSS_HEAP_CLASS_POOL_DEFINE
+ *  define the memory area for mss_heap_add_class_static at compile time
+ */
+#define MSS_HEAP_CLASS_POOL_DEFINE(name, block_size, num_of_blocks)        \
+        static uint8_t name[MSS_HEAP_CLASS_POOL_SIZE(block_size, num_of_blocks)]
+
+//*****************************************************************************
+// External function declarations
+//*****************************************************************************
+
+/**
+ * @name MSS Heap API Functions
+ * @{
+ */
+
+/**************************************************************************//**
+*
+* mss_heap_add_class
+*
+* @brief      add a size class to the heap, a memory block list of the MSS
+*             memory module is created for the size class. The size classes
+*             shall be added in ascending order of block size
+*
+* @param[in]  block_size      size of a memory block of the size class in
+*                             bytes, rounded up to MSS_HEAP_GRANULE
+* @param[in]  num_of_blocks   number of memory blocks of the size class
+*
+* @return     true if success, false if no more size class can be added or
+*             the memory block list can not be created
+*
+******************************************************************************/
+bool mss_heap_add_class(uint16_t block_size, uint16_t num_of_blocks);
+
+/**************************************************************************//**
+*
+* mss_heap_add_class_static
+*
+* @brief      add a size class to the heap like mss_heap_add_class, but the
+*             memory blocks of the size class are placed in a memory area
+*             given by the caller
+*
+* @param[in]  buf             pointer to the memory area, shall have at least
+*                             MSS_HEAP_CLASS_POOL_SIZE(block_size,
+*                             num_of_blocks) bytes (see
+*                             MSS_HEAP_CLASS_POOL_DEFINE)
+* @param[in]  block_size      size of a memory block of the size class in
+*                             bytes, rounded up to MSS_HEAP_GRANULE
+* @param[in]  num_of_blocks   number of memory blocks of the size class
+*
+* @return     true if success, false if no more size class can be added or
+*             the memory block list can not be created
+*
+******************************************************************************/
+bool mss_heap_add_class_static(void* buf, uint16_t block_size,
+                               uint16_t num_of_blocks);
+
+/**************************************************************************//**
+*
+* mss_heap_alloc
+*
+* @brief      allocate a memory block from the smallest size class fitting
+*             the requested size. If the size class is exhausted, the next
+*             larger size class is used
+*
+* @param[in]  size     requested size in bytes
+*
+* @return     NULL if failed, otherwise pointer to the allocated memory block
+*
+******************************************************************************/
+void* mss_heap_alloc(uint16_t size);
+
+/**************************************************************************//**
+*
+* mss_heap_free
+*
+* @brief      free a memory block allocated by mss_heap_alloc
+*
+* @param[in]  data     pointer of the data to be freed
+*
+* @return     -
+*
+******************************************************************************/
+void mss_heap_free(void* data);
+
+/** @} MSS Heap API Functions */
+
+/** @} MSS_Heap_API */
+
+#endif /* _MSS_HEAP_H_*/
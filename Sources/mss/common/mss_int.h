@@ -69,6 +69,27 @@ typedef uint32_t mss_task_bits_t;
 #error maximum number of tasks shall be only 32!
 #endif
 
+#if ((MSS_TASK_USE_TIMEOUT == TRUE) && (MSS_TASK_USE_TIMER != TRUE))
+#error MSS_TASK_USE_TIMEOUT needs MSS_TASK_USE_TIMER set to TRUE!
+#endif
+
+#if ((MSS_TASK_USE_TOPIC == TRUE) && (MSS_TASK_USE_BUF != TRUE))
+#error MSS_TASK_USE_TOPIC needs MSS_TASK_USE_BUF set to TRUE!
+#endif
+
+#if ((MSS_TASK_USE_HEAP == TRUE) && (MSS_TASK_USE_MEM != TRUE))
+#error MSS_TASK_USE_HEAP needs MSS_TASK_USE_MEM set to TRUE!
+#endif
+
+#if ((MSS_TASK_USE_BUF == TRUE) && (MSS_TASK_USE_MEM != TRUE))
+#error MSS_TASK_USE_BUF needs MSS_TASK_USE_MEM set to TRUE!
+#endif
+
+#if ((MSS_TASK_USE_HEAP == TRUE) && \
+     ((MSS_HEAP_MAX_BLOCK_SIZE % MSS_HEAP_GRANULE) != 0))
+#error MSS_HEAP_MAX_BLOCK_SIZE shall be a multiple of MSS_HEAP_GRANULE!
+#endif
+
 /** MSS_TASK_BIT_POS
  *  array of constant containing task bit position values - used a lot for
  *  setting or resetting a bit in the @ref mss_task_bits_t data type
@@ -125,6 +146,30 @@ extern mss_task_bits_t mss_ready_task_bits;
  */
 extern const mss_task_bits_t mss_bitpos_to_bit[];
 
+#if (MSS_ISR_FAST_PATH == TRUE)
+/** mss_isr_ready_task_bits
+ *  flag bits of tasks activated by ISR fast path which are not yet taken
+ *  over into mss_ready_task_bits by the scheduler
+ */
+extern volatile mss_task_bits_t mss_isr_ready_task_bits;
+#endif /* (MSS_ISR_FAST_PATH == TRUE) */
+
+#if (MSS_TASK_USE_MUTEX == TRUE)
+/** mss_running_task_prio
+ *  priority of mss task which is currently being executed, raised to the
+ *  ceiling of the mutexes it has locked
+ */
+extern uint8_t mss_running_task_prio;
+
+/** MSS_RUNNING_TASK_PRIO
+ *  priority of the running task, which is raised to the priority ceiling of
+ *  a mutex while the running task holds it
+ */
+#define MSS_RUNNING_TASK_PRIO          mss_running_task_prio
+#else
+#define MSS_RUNNING_TASK_PRIO          mss_running_task_id
+#endif /* (MSS_TASK_USE_MUTEX == TRUE) */
+
 #if (MSS_TASK_USE_TIMER == TRUE)
 /** mss_timer_tick_cnt
  *  mss hardware timer tick counter
@@ -243,6 +288,21 @@ mss_timer_tick_t mss_timer_get_next_tick(void);
 void mss_event_init(void);
 #endif /* (MSS_TASK_USE_EVENT == TRUE) */
 
+#if (MSS_TASK_USE_BUF == TRUE)
+/**************************************************************************//**
+*
+* mss_buf_init
+*
+* @brief      initialize buffer module
+*
+* @param      -
+*
+* @return     -
+*
+******************************************************************************/
+void mss_buf_init(void);
+#endif /* (MSS_TASK_USE_BUF == TRUE) */
+
 /**************************************************************************//**
 *
 * mss_get_highest_prio_task
@@ -275,6 +335,38 @@ uint8_t mss_get_highest_prio_task(mss_task_bits_t ready_bits);
 ******************************************************************************/
 void mss_activate_task_int(uint8_t task_id);
 
+/**************************************************************************//**
+*
+* mss_activate_tasks_int
+*
+* @brief      internal MSS function to put several tasks into active state
+*             at once - not reentrant
+*
+* @param[in]  task_bits   bits of the tasks to be activated
+*
+* @return     -
+*
+******************************************************************************/
+void mss_activate_tasks_int(mss_task_bits_t task_bits);
+
+#if (MSS_TASK_USE_MUTEX == TRUE)
+/**************************************************************************//**
+*
+* mss_set_running_prio_int
+*
+* @brief      internal MSS function to change the priority of the running
+*             task when it locks or unlocks a mutex. If the priority is
+*             lowered and a task with higher priority is ready, the running
+*             task is preempted - not reentrant
+*
+* @param[in]  prio       new priority of the running task
+*
+* @return     -
+*
+******************************************************************************/
+void mss_set_running_prio_int(uint8_t prio);
+#endif /* (MSS_TASK_USE_MUTEX == TRUE) */
+
 /**************************************************************************//**
 *
 * mss_hal_init
@@ -63,7 +63,13 @@
  *  mss memory table data type
  */
 struct mss_mem_tbl_t {
-  llist_t free_blks;
+  void *free_blks;
+  uint8_t *first_blk;
+  uint8_t *end_blk;
+  mss_task_bits_t waiting_tasks;
+#if (MSS_MEM_USE_STATS == TRUE)
+  mss_mem_stats_t stats;
+#endif /* (MSS_MEM_USE_STATS == TRUE) */
 };
 
 // number of created memory block
@@ -72,12 +78,55 @@ static uint8_t num_of_mem = 0;
 // memory table
 static struct mss_mem_tbl_t mem_tbl[MSS_MAX_NUM_OF_MEM];
 
-#define LLIST_HDR_LEN   sizeof(void*)
+#if (MSS_MAX_NUM_OF_MEM_ISR > 0)
+/** mss_mem_isr_tbl_t
+ *  ISR side of a memory block list: a private free block stack which only
+ *  its ISR uses, and a ring through which tasks hand the freed blocks back.
+ *  Only tasks write ret_wr and only the ISR writes ret_rd.
+ */
+struct mss_mem_isr_tbl_t {
+  void *free_blks;
+  void* volatile *ret_ring;
+  volatile uint16_t ret_wr;
+  volatile uint16_t ret_rd;
+  uint16_t ret_len;
+};
+
+// number of created ISR sides
+static uint8_t num_of_mem_isr = 0;
+
+// ISR side table
+static struct mss_mem_isr_tbl_t mem_isr_tbl[MSS_MAX_NUM_OF_MEM_ISR];
+#endif /* (MSS_MAX_NUM_OF_MEM_ISR > 0) */
+
+// hidden header before every memory block data, holds the link to the next
+// free memory block while the memory block is free, and the ISR side which
+// allocated it (NULL for tasks) while the memory block is used
+#define MEM_HDR_LEN     sizeof(void*)
+
+// ISR side of an allocated memory block
+#define MEM_BLK_SIDE(data)  (*((void**)(((uint8_t*)(data)) - MEM_HDR_LEN)))
+
+// ISRs never use the task side of a memory block list, a critical section
+// is only needed if tasks can preempt each other
+#if (MSS_PREEMPTIVE_SCHEDULING == TRUE)
+#define MEM_ENTER_TASK_SECTION(int_flag)  MSS_ENTER_CRITICAL_SECTION(int_flag)
+#define MEM_LEAVE_TASK_SECTION(int_flag)  MSS_LEAVE_CRITICAL_SECTION(int_flag)
+#else
+#define MEM_ENTER_TASK_SECTION(int_flag)  ((void)&(int_flag))
+#define MEM_LEAVE_TASK_SECTION(int_flag)  ((void)&(int_flag))
+#endif /* (MSS_PREEMPTIVE_SCHEDULING == TRUE) */
 
 //*****************************************************************************
 // Internal function declarations
 //*****************************************************************************
 
+static void* mem_pop(mss_mem_t hdl);
+static void mem_push(mss_mem_t hdl, void* data);
+static uint8_t mem_get_waiting_task(mss_mem_t hdl);
+#if (MSS_MAX_NUM_OF_MEM_ISR > 0)
+static void mem_isr_hand_back(mss_mem_isr_t hdl, void* data);
+#endif /* (MSS_MAX_NUM_OF_MEM_ISR > 0) */
 
 //*****************************************************************************
 // External functions
@@ -100,28 +149,93 @@ static struct mss_mem_tbl_t mem_tbl[MSS_MAX_NUM_OF_MEM];
 *             message queue's message size plus the size of a pointer variable
 *
 ******************************************************************************/
-mss_mem_t mss_mem_create(uint8_t block_size, uint8_t num_of_blocks)
+mss_mem_t mss_mem_create(uint16_t block_size, uint16_t num_of_blocks)
 {
   mss_mem_t ret_hdl = MSS_MEM_INVALID_HDL;
-  uint8_t *data, i;
-  uint16_t real_blk_size = block_size + LLIST_HDR_LEN;
+  uint8_t *data;
 
-  // check if there is a free semaphore block
+  // check if there is a free memory block list
   if(num_of_mem < MSS_MAX_NUM_OF_MEM)
   {
-    // initialize linked list
-    mem_tbl[num_of_mem].free_blks = llist_create();
-    MSS_DEBUG_CHECK(mem_tbl[num_of_mem].free_blks != LLIST_INVALID_HDL);
-
     // try to allocate memory dynamically
-    data = MSS_MALLOC(real_blk_size * num_of_blocks);
+    data = MSS_MALLOC(MSS_MEM_POOL_SIZE(block_size, num_of_blocks,
+                                        sizeof(void*)));
     MSS_DEBUG_CHECK(data != NULL)
 
-    // put the blocks into free block list in the beginning
+    if(data != NULL)
+    {
+      ret_hdl = mss_mem_create_static(data, block_size, num_of_blocks,
+                                      sizeof(void*));
+    }
+  }
+
+  return ret_hdl;
+}
+
+/**************************************************************************//**
+*
+* mss_mem_create_static
+*
+* @brief      create memory block list in a memory area given by the caller,
+*             once created can not be deleted
+*
+* @param[in]  buf             pointer to the memory area, shall have at least
+*                             MSS_MEM_POOL_SIZE(block_size, num_of_blocks,
+*                             align) bytes (see MSS_MEM_POOL_DEFINE)
+* @param[in]  block_size      size of a single memory block in bytes
+* @param[in]  num_of_blocks   number of memory blocks to be created
+* @param[in]  align           alignment of the memory blocks in bytes, shall
+*                             be a power of two, raised to the size of a
+*                             pointer if smaller (see MSS_MEM_ALIGN)
+*
+* @return     MSS_MEM_INVALID_HDL - failed to create memory blocks
+*             other - valid mss memory blocks handle
+*
+******************************************************************************/
+mss_mem_t mss_mem_create_static(void* buf, uint16_t block_size,
+                                uint16_t num_of_blocks, uint8_t align)
+{
+  mss_mem_t ret_hdl = MSS_MEM_INVALID_HDL;
+  uint8_t *data;
+  uint16_t i, real_blk_size = MSS_MEM_BLOCK_STRIDE(block_size, align);
+
+  // check parameters
+  MSS_DEBUG_CHECK((buf != NULL) && (align > 0) &&
+                  ((align & (align - 1)) == 0));
+
+  // the hidden header of every memory block shall be aligned for a pointer
+  align = MSS_MEM_ALIGN(align);
+
+  // check if there is a free memory block list
+  if(num_of_mem < MSS_MAX_NUM_OF_MEM)
+  {
+    // initialize free block stack
+    mem_tbl[num_of_mem].free_blks = NULL;
+    mem_tbl[num_of_mem].waiting_tasks = 0;
+
+    // skip the bytes before the first aligned block data, the link header
+    // lies directly before the block data
+    data = ((uint8_t*)buf) + ((align - (((uintptr_t)buf + MEM_HDR_LEN) &
+                                        (align - 1))) & (align - 1));
+
+    // save memory area for mss_mem_check_block
+    mem_tbl[num_of_mem].first_blk = data;
+    mem_tbl[num_of_mem].end_blk = data + (real_blk_size * num_of_blocks);
+
+  #if (MSS_MEM_USE_STATS == TRUE)
+    // initialize statistics
+    mem_tbl[num_of_mem].stats.num_of_blocks = num_of_blocks;
+    mem_tbl[num_of_mem].stats.used_blocks = 0;
+    mem_tbl[num_of_mem].stats.peak_used_blocks = 0;
+    mem_tbl[num_of_mem].stats.failed_allocs = 0;
+  #endif /* (MSS_MEM_USE_STATS == TRUE) */
+
+    // put the blocks into free block stack in the beginning
     for(i=0 ; i<num_of_blocks ; i++)
     {
-      // insert block into the list
-      llist_add_first(mem_tbl[num_of_mem].free_blks, data);
+      // push block onto the stack
+      *((void**)data) = mem_tbl[num_of_mem].free_blks;
+      mem_tbl[num_of_mem].free_blks = data;
 
       // update pointer
       data += real_blk_size;
@@ -144,6 +258,9 @@ mss_mem_t mss_mem_create(uint8_t block_size, uint8_t num_of_blocks)
 *
 * @return     NULL if failed, otherwise pointer to the allocated memory block
 *
+* @remark     shall only be called from tasks, ISRs allocate from an ISR side
+*             (see mss_mem_isr_create)
+*
 ******************************************************************************/
 void* mss_mem_alloc(mss_mem_t hdl)
 {
@@ -153,12 +270,60 @@ void* mss_mem_alloc(mss_mem_t hdl)
   // check handle
   MSS_DEBUG_CHECK(hdl != MSS_MEM_INVALID_HDL);
 
-  MSS_ENTER_CRITICAL_SECTION(int_flag);
+  MEM_ENTER_TASK_SECTION(int_flag);
   
-  // get a memory block from free list
-  ret = (((uint8_t*) llist_get_first(hdl->free_blks)) + LLIST_HDR_LEN);
+  // get a memory block from free block stack
+  ret = mem_pop(hdl);
   
-  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+  MEM_LEAVE_TASK_SECTION(int_flag);
+
+  return ret;
+}
+
+/**************************************************************************//**
+*
+* mss_mem_wait_alloc
+*
+* @brief      allocate a memory block, and put the running task into the
+*             waiting list of the memory block list if no memory block is
+*             available. The task will be activated when a memory block is
+*             freed
+*
+* @param[in]  hdl      memory blocks handle
+*
+* @return     NULL if failed, otherwise pointer to the allocated memory block
+*
+* @remark     shall only be called from tasks
+*
+******************************************************************************/
+void* mss_mem_wait_alloc(mss_mem_t hdl)
+{
+  void* ret;
+  mss_task_bits_t task_bit;
+  mss_int_flag_t int_flag;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_MEM_INVALID_HDL);
+
+  // turn running task id into bit position
+  task_bit = mss_bitpos_to_bit[mss_running_task_id];
+
+  MEM_ENTER_TASK_SECTION(int_flag);
+
+  // get a memory block from free block stack
+  ret = mem_pop(hdl);
+
+  if(ret == NULL)
+  {
+    // no memory block available, put task into waiting list
+    hdl->waiting_tasks |= task_bit;
+  }
+  else
+  {
+    hdl->waiting_tasks &= ~task_bit;
+  }
+
+  MEM_LEAVE_TASK_SECTION(int_flag);
 
   return ret;
 }
@@ -174,28 +339,411 @@ void* mss_mem_alloc(mss_mem_t hdl)
 *
 * @return     -
 *
+* @remark     shall only be called from tasks. Memory blocks allocated by an
+*             ISR side are handed back to that ISR side.
+*
 ******************************************************************************/
 void mss_mem_free(mss_mem_t hdl, void* data)
 {
-  uint8_t* mem_blk;
+  uint8_t waiting_task_id = MSS_INVALID_TASK_ID;
   mss_int_flag_t int_flag;
 
   // check handle
   MSS_DEBUG_CHECK(hdl != MSS_MEM_INVALID_HDL);
 
-  MSS_ENTER_CRITICAL_SECTION(int_flag);
+  MEM_ENTER_TASK_SECTION(int_flag);
+
+#if (MSS_MAX_NUM_OF_MEM_ISR > 0)
+  if(MEM_BLK_SIDE(data) != NULL)
+  {
+    // the memory block belongs to an ISR side
+    mem_isr_hand_back((mss_mem_isr_t)MEM_BLK_SIDE(data), data);
+  }
+  else
+#endif /* (MSS_MAX_NUM_OF_MEM_ISR > 0) */
+  {
+    // return the memory block to free block stack
+    mem_push(hdl, data);
+
+    // remove the waiting task with highest priority
+    waiting_task_id = mem_get_waiting_task(hdl);
+  }
+
+  MEM_LEAVE_TASK_SECTION(int_flag);
+
+  if(waiting_task_id != MSS_INVALID_TASK_ID)
+  {
+    mss_activate_task(waiting_task_id);
+  }
+}
+
+#if (MSS_MAX_NUM_OF_MEM_ISR > 0)
+/**************************************************************************//**
+*
+* mss_mem_isr_create
+*
+* @brief      create an ISR side of a memory block list, which moves memory
+*             blocks from the memory block list into a free block stack
+*             private to one ISR. Once created can not be deleted
+*
+* @param[in]  hdl             memory blocks handle
+* @param[in]  num_of_blocks   number of memory blocks for the ISR
+*
+* @return     MSS_MEM_ISR_INVALID_HDL - failed to create the ISR side
+*             other - valid ISR side handle
+*
+******************************************************************************/
+mss_mem_isr_t mss_mem_isr_create(mss_mem_t hdl, uint16_t num_of_blocks)
+{
+  mss_mem_isr_t ret_hdl = MSS_MEM_ISR_INVALID_HDL;
+  void *ring;
+
+  // check if there is a free ISR side
+  if(num_of_mem_isr < MSS_MAX_NUM_OF_MEM_ISR)
+  {
+    // try to allocate the hand back ring dynamically
+    ring = MSS_MALLOC(MSS_MEM_ISR_RING_SIZE(num_of_blocks));
+    MSS_DEBUG_CHECK(ring != NULL);
+
+    if(ring != NULL)
+    {
+      ret_hdl = mss_mem_isr_create_static(ring, hdl, num_of_blocks);
+    }
+  }
+
+  return ret_hdl;
+}
+
+/**************************************************************************//**
+*
+* mss_mem_isr_create_static
+*
+* @brief      create an ISR side of a memory block list like
+*             mss_mem_isr_create with a hand back ring given by the caller
+*
+* @param[in]  ring            pointer to the hand back ring, shall have at
+*                             least MSS_MEM_ISR_RING_SIZE(num_of_blocks)
+*                             bytes (see MSS_MEM_ISR_RING_DEFINE)
+* @param[in]  hdl             memory blocks handle
+* @param[in]  num_of_blocks   number of memory blocks for the ISR
+*
+* @return     MSS_MEM_ISR_INVALID_HDL - failed to create the ISR side
+*             other - valid ISR side handle
+*
+* @remark     shall be called from a task before the ISR uses the ISR side.
+*             The memory blocks of the ISR side count as used blocks of the
+*             memory block list in mss_mem_stats.
+*
+******************************************************************************/
+mss_mem_isr_t mss_mem_isr_create_static(void* ring, mss_mem_t hdl,
+                                        uint16_t num_of_blocks)
+{
+  mss_mem_isr_t ret_hdl = MSS_MEM_ISR_INVALID_HDL;
+  mss_mem_isr_t isr_hdl;
+  uint8_t* data;
+  uint16_t i;
+  mss_int_flag_t int_flag;
+
+  // check parameters
+  MSS_DEBUG_CHECK((ring != NULL) && (hdl != MSS_MEM_INVALID_HDL) &&
+                  (num_of_blocks > 0));
+
+  // check if there is a free ISR side
+  if(num_of_mem_isr < MSS_MAX_NUM_OF_MEM_ISR)
+  {
+    isr_hdl = &mem_isr_tbl[num_of_mem_isr];
+    isr_hdl->free_blks = NULL;
+    isr_hdl->ret_ring = (void* volatile *)ring;
+    isr_hdl->ret_wr = 0;
+    isr_hdl->ret_rd = 0;
+    isr_hdl->ret_len = num_of_blocks + 1;
+
+    MEM_ENTER_TASK_SECTION(int_flag);
+
+    // move the memory blocks into the private free block stack
+    for(i=0 ; i<num_of_blocks ; i++)
+    {
+      data = mem_pop(hdl);
+      if(data == NULL)
+      {
+        break;
+      }
+
+      data -= MEM_HDR_LEN;
+      *((void**)data) = isr_hdl->free_blks;
+      isr_hdl->free_blks = data;
+    }
+
+    if(i == num_of_blocks)
+    {
+      // return handle and increment number of ISR side
+      ret_hdl = &mem_isr_tbl[num_of_mem_isr++];
+    }
+    else
+    {
+      // not enough free memory blocks, give them back
+      while(isr_hdl->free_blks != NULL)
+      {
+        data = isr_hdl->free_blks;
+        isr_hdl->free_blks = *((void**)data);
+        mem_push(hdl, data + MEM_HDR_LEN);
+      }
+    }
+
+    MEM_LEAVE_TASK_SECTION(int_flag);
+  }
+
+  return ret_hdl;
+}
+
+/**************************************************************************//**
+*
+* mss_mem_isr_alloc
+*
+* @brief      allocate a memory block from an ISR side without entering
+*             critical section
+*
+* @param[in]  hdl      ISR side handle
+*
+* @return     NULL if failed, otherwise pointer to the allocated memory block
+*
+* @remark     shall only be called from the one ISR which owns the ISR side.
+*             Other ISRs, also nested ones, and tasks do not touch its free
+*             block stack, so no critical section is needed.
+*
+******************************************************************************/
+void* mss_mem_isr_alloc(mss_mem_isr_t hdl)
+{
+  uint8_t* mem_blk;
+  uint16_t rd;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_MEM_ISR_INVALID_HDL);
+
+  mem_blk = hdl->free_blks;
+  if(mem_blk != NULL)
+  {
+    hdl->free_blks = *((void**)mem_blk);
+  }
+  else if(hdl->ret_rd != hdl->ret_wr)
+  {
+    // take a memory block handed back by a task
+    rd = hdl->ret_rd;
+    mem_blk = hdl->ret_ring[rd];
+    hdl->ret_rd = ((rd + 1) == hdl->ret_len) ? 0 : (rd + 1);
+  }
+
+  if(mem_blk != NULL)
+  {
+    // mark the memory block as allocated by this ISR side
+    *((void**)mem_blk) = hdl;
+    mem_blk += MEM_HDR_LEN;
+  }
+
+  return mem_blk;
+}
+
+/**************************************************************************//**
+*
+* mss_mem_isr_free
+*
+* @brief      free a memory block allocated by an ISR side from its ISR
+*             without entering critical section
+*
+* @param[in]  hdl      ISR side handle
+* @param[in]  data     pointer of the data to be freed
+*
+* @return     -
+*
+* @remark     shall only be called from the one ISR which owns the ISR side,
+*             and only for memory blocks allocated from this ISR side
+*
+******************************************************************************/
+void mss_mem_isr_free(mss_mem_isr_t hdl, void* data)
+{
+  // check parameters
+  MSS_DEBUG_CHECK((hdl != MSS_MEM_ISR_INVALID_HDL) &&
+                  (MEM_BLK_SIDE(data) == hdl));
+
+  data = ((uint8_t*)data) - MEM_HDR_LEN;
+  *((void**)data) = hdl->free_blks;
+  hdl->free_blks = data;
+}
+#endif /* (MSS_MAX_NUM_OF_MEM_ISR > 0) */
 
-  // return a memory block to free list
-  mem_blk = ((uint8_t*)data) - LLIST_HDR_LEN;
-  llist_add_last(hdl->free_blks, mem_blk);
+/**************************************************************************//**
+*
+* mss_mem_check_block
+*
+* @brief      check whether a memory block belongs to a memory block list
+*
+* @param[in]  hdl      memory blocks handle
+* @param[in]  data     pointer of the data of the memory block
+*
+* @return     true if the memory block belongs to the memory block list
+*
+******************************************************************************/
+bool mss_mem_check_block(mss_mem_t hdl, void* data)
+{
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_MEM_INVALID_HDL);
 
-  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+  return ((((uint8_t*)data) > hdl->first_blk) &&
+          (((uint8_t*)data) < hdl->end_blk));
 }
 
 
+#if (MSS_MEM_USE_STATS == TRUE)
+/**************************************************************************//**
+*
+* mss_mem_stats
+*
+* @brief      get the usage statistics of a memory block list
+*
+* @param[in]  hdl      memory blocks handle
+* @param[out] stats    buffer for storing the statistics
+*
+* @return     -
+*
+******************************************************************************/
+void mss_mem_stats(mss_mem_t hdl, mss_mem_stats_t* stats)
+{
+  mss_int_flag_t int_flag;
+
+  // check parameters
+  MSS_DEBUG_CHECK((hdl != MSS_MEM_INVALID_HDL) && (stats != NULL));
+
+  MEM_ENTER_TASK_SECTION(int_flag);
+
+  *stats = hdl->stats;
+
+  MEM_LEAVE_TASK_SECTION(int_flag);
+}
+#endif /* (MSS_MEM_USE_STATS == TRUE) */
+
 //*****************************************************************************
 // Internal functions
 //*****************************************************************************
 
+/**************************************************************************//**
+*
+* mem_pop
+*
+* @brief      pop the most recently freed memory block from the free block
+*             stack - not reentrant
+*
+* @param[in]  hdl      memory blocks handle
+*
+* @return     NULL if the stack is empty, otherwise pointer to the data of
+*             the memory block
+*
+******************************************************************************/
+static void* mem_pop(mss_mem_t hdl)
+{
+  void* ret = hdl->free_blks;
+
+  if(ret != NULL)
+  {
+    hdl->free_blks = *((void**)ret);
+
+    // mark the memory block as allocated by a task
+    *((void**)ret) = NULL;
+    ret = ((uint8_t*)ret) + MEM_HDR_LEN;
+
+  #if (MSS_MEM_USE_STATS == TRUE)
+    // update usage and high-water mark
+    if(++hdl->stats.used_blocks > hdl->stats.peak_used_blocks)
+    {
+      hdl->stats.peak_used_blocks = hdl->stats.used_blocks;
+    }
+  #endif /* (MSS_MEM_USE_STATS == TRUE) */
+  }
+#if (MSS_MEM_USE_STATS == TRUE)
+  else if(hdl->stats.failed_allocs < 0xFFFF)
+  {
+    hdl->stats.failed_allocs++;
+  }
+#endif /* (MSS_MEM_USE_STATS == TRUE) */
+
+  return ret;
+}
+
+/**************************************************************************//**
+*
+* mem_push
+*
+* @brief      push a memory block onto the free block stack - not reentrant
+*
+* @param[in]  hdl      memory blocks handle
+* @param[in]  data     pointer of the data of the memory block
+*
+* @return     -
+*
+******************************************************************************/
+static void mem_push(mss_mem_t hdl, void* data)
+{
+  uint8_t* mem_blk = ((uint8_t*)data) - MEM_HDR_LEN;
+
+  *((void**)mem_blk) = hdl->free_blks;
+  hdl->free_blks = mem_blk;
+
+#if (MSS_MEM_USE_STATS == TRUE)
+  MSS_DEBUG_CHECK(hdl->stats.used_blocks > 0);
+  hdl->stats.used_blocks--;
+#endif /* (MSS_MEM_USE_STATS == TRUE) */
+}
+
+
+/**************************************************************************//**
+*
+* mem_get_waiting_task
+*
+* @brief      remove the waiting task with the highest priority from the
+*             waiting list of a memory block list - not reentrant
+*
+* @param[in]  hdl      memory blocks handle
+*
+* @return     task id of the waiting task, MSS_INVALID_TASK_ID if no task is
+*             waiting
+*
+******************************************************************************/
+static uint8_t mem_get_waiting_task(mss_mem_t hdl)
+{
+  uint8_t ret = MSS_INVALID_TASK_ID;
+
+  if(hdl->waiting_tasks)
+  {
+    ret = mss_get_highest_prio_task(hdl->waiting_tasks);
+    hdl->waiting_tasks &= ~mss_bitpos_to_bit[ret];
+  }
+
+  return ret;
+}
+
+#if (MSS_MAX_NUM_OF_MEM_ISR > 0)
+/**************************************************************************//**
+*
+* mem_isr_hand_back
+*
+* @brief      hand a memory block back to its ISR side through the ring,
+*             tasks are the only writer of the ring - not reentrant
+*
+* @param[in]  hdl      ISR side handle
+* @param[in]  data     pointer of the data of the memory block
+*
+* @return     -
+*
+******************************************************************************/
+static void mem_isr_hand_back(mss_mem_isr_t hdl, void* data)
+{
+  uint16_t wr = hdl->ret_wr;
+
+  // the ring can hold all memory blocks of the ISR side, it never overflows
+  hdl->ret_ring[wr] = ((uint8_t*)data) - MEM_HDR_LEN;
+
+  // publish the memory block to the ISR after it is stored
+  hdl->ret_wr = ((wr + 1) == hdl->ret_len) ? 0 : (wr + 1);
+}
+#endif /* (MSS_MAX_NUM_OF_MEM_ISR > 0) */
 
 #endif /* (MSS_TASK_USE_MEM == TRUE) */
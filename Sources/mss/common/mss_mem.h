@@ -37,7 +37,9 @@
 * @author   Leo Hendrawan
 * 
 * @remark   this will be included in compilation only if MSS_TASK_USE_MEM
-*           defined as TRUE
+*           defined as TRUE. Memory block lists are used by tasks without
+*           masking interrupts, ISRs use their own ISR sides of a memory
+*           block list (see mss_mem_isr_create).
 * 
 ******************************************************************************/
 
@@ -81,8 +83,85 @@ typedef struct mss_mem_tbl_t*  mss_mem_t;
  */
 #define MSS_MEM_INVALID_HDL      ((mss_mem_t)NULL)
 
+#if (MSS_MAX_NUM_OF_MEM_ISR > 0)
+/** mss_mem_isr_t
+ *  mss memory ISR side handle data type
+ */
+typedef struct mss_mem_isr_tbl_t*  mss_mem_isr_t;
+
+/** MSS_MEM_ISR_INVALID_HDL
+ *  invalid memory ISR side handle
+ */
+#define MSS_MEM_ISR_INVALID_HDL  ((mss_mem_isr_t)NULL)
+#endif /* (MSS_MAX_NUM_OF_MEM_ISR > 0) */
+
 /** @} MSS Memory Handles */
 
+#if (MSS_MEM_USE_STATS == TRUE)
+/** mss_mem_stats_t
+ *  mss memory block list usage statistics data type
+ */
+typedef struct {
+  /** number of memory blocks */
+  uint16_t num_of_blocks;
+  /** number of currently allocated memory blocks */
+  uint16_t used_blocks;
+  /** high-water mark of allocated memory blocks */
+  uint16_t peak_used_blocks;
+  /** number of failed allocations (saturates at 0xFFFF) */
+  uint16_t failed_allocs;
+}mss_mem_stats_t;
+#endif /* (MSS_MEM_USE_STATS == TRUE) */
+
+/**
+ * @name MSS Memory Pool Storage
+ * @{
+ */
+
+/** MSS_MEM_ALIGN
+ *  alignment of the memory blocks in bytes, at least the size of a pointer
+ *  so that the hidden header of every memory block is aligned
+ */
+#define MSS_MEM_ALIGN(align)                                               \
+        (((align) > sizeof(void*)) ? (align) : sizeof(void*))
+
+/** MSS_MEM_BLOCK_STRIDE
+ *  distance between two memory blocks in bytes, every memory block has a
+ *  hidden header of the size of a pointer for the free block list
+ */
+#define MSS_MEM_BLOCK_STRIDE(block_size, align)                            \
+        ((((block_size) + sizeof(void*) + MSS_MEM_ALIGN(align) - 1) /      \
+          MSS_MEM_ALIGN(align)) * MSS_MEM_ALIGN(align))
+
+/** MSS_MEM_POOL_SIZE
+ *  size of the memory area needed by mss_mem_create_static in bytes
+ */
+#define MSS_MEM_POOL_SIZE(block_size, num_of_blocks, align)                \
+        (((num_of_blocks) * MSS_MEM_BLOCK_STRIDE(block_size, align)) +     \
+         MSS_MEM_ALIGN(align) - 1)
+
+/** MSS_MEM_POOL_DEFINE
+ *  define the memory area for mss_mem_create_static at compile time
+ */
+#define MSS_MEM_POOL_DEFINE(name, block_size, num_of_blocks, align)        \
+        static uint8_t name[MSS_MEM_POOL_SIZE(block_size, num_of_blocks, align)]
+
+#if (MSS_MAX_NUM_OF_MEM_ISR > 0)
+/** MSS_MEM_ISR_RING_SIZE
+ *  size of the hand back ring needed by mss_mem_isr_create_static in bytes
+ */
+#define MSS_MEM_ISR_RING_SIZE(num_of_blocks)                               \
+        (((num_of_blocks) + 1) * sizeof(void*))
+
+/** MSS_MEM_ISR_RING_DEFINE
+ *  define the hand back ring for mss_mem_isr_create_static at compile time
+ */
+#define MSS_MEM_ISR_RING_DEFINE(name, num_of_blocks)                       \
+        static void* name[(num_of_blocks) + 1]
+#endif /* (MSS_MAX_NUM_OF_MEM_ISR > 0) */
+
+/** @} MSS Memory Pool Storage */
+
 //*****************************************************************************
 // External function declarations
 //*****************************************************************************
@@ -109,7 +188,30 @@ typedef struct mss_mem_tbl_t*  mss_mem_t;
 *             message queue's message size plus the size of a pointer variable
 *
 ******************************************************************************/
-mss_mem_t mss_mem_create(uint8_t block_size, uint8_t num_of_blocks);
+mss_mem_t mss_mem_create(uint16_t block_size, uint16_t num_of_blocks);
+
+/**************************************************************************//**
+*
+* mss_mem_create_static
+*
+* @brief      create memory block list in a memory area given by the caller,
+*             once created can not be deleted
+*
+* @param[in]  buf             pointer to the memory area, shall have at least
+*                             MSS_MEM_POOL_SIZE(block_size, num_of_blocks,
+*                             align) bytes (see MSS_MEM_POOL_DEFINE)
+* @param[in]  block_size      size of a single memory block in bytes
+* @param[in]  num_of_blocks   number of memory blocks to be created
+* @param[in]  align           alignment of the memory blocks in bytes, shall
+*                             be a power of two, raised to the size of a
+*                             pointer if smaller (see MSS_MEM_ALIGN)
+*
+* @return     MSS_MEM_INVALID_HDL - failed to create memory blocks
+*             other - valid mss memory blocks handle
+*
+******************************************************************************/
+mss_mem_t mss_mem_create_static(void* buf, uint16_t block_size,
+                                uint16_t num_of_blocks, uint8_t align);
 
 /**************************************************************************//**
 *
@@ -121,9 +223,30 @@ mss_mem_t mss_mem_create(uint8_t block_size, uint8_t num_of_blocks);
 *
 * @return     NULL if failed, otherwise pointer to the allocated memory block
 *
+* @remark     shall only be called from tasks, ISRs allocate from an ISR side
+*             (see mss_mem_isr_create)
+*
 ******************************************************************************/
 void* mss_mem_alloc(mss_mem_t hdl);
 
+/**************************************************************************//**
+*
+* mss_mem_wait_alloc
+*
+* @brief      allocate a memory block, and put the running task into the
+*             waiting list of the memory block list if no memory block is
+*             available. The task will be activated when a memory block is
+*             freed
+*
+* @param[in]  hdl      memory blocks handle
+*
+* @return     NULL if failed, otherwise pointer to the allocated memory block
+*
+* @remark     shall only be called from tasks
+*
+******************************************************************************/
+void* mss_mem_wait_alloc(mss_mem_t hdl);
+
 /**************************************************************************//**
 *
 * mss_mem_free
@@ -135,9 +258,139 @@ void* mss_mem_alloc(mss_mem_t hdl);
 *
 * @return     -
 *
+* @remark     shall only be called from tasks. Memory blocks allocated by an
+*             ISR side are handed back to that ISR side.
+*
 ******************************************************************************/
 void mss_mem_free(mss_mem_t hdl, void* data);
 
+#if (MSS_MAX_NUM_OF_MEM_ISR > 0)
+/**************************************************************************//**
+*
+* mss_mem_isr_create
+*
+* @brief      create an ISR side of a memory block list, which moves memory
+*             blocks from the memory block list into a free block stack
+*             private to one ISR. Once created can not be deleted
+*
+* @param[in]  hdl             memory blocks handle
+* @param[in]  num_of_blocks   number of memory blocks for the ISR
+*
+* @return     MSS_MEM_ISR_INVALID_HDL - failed to create the ISR side
+*             other - valid ISR side handle
+*
+******************************************************************************/
+mss_mem_isr_t mss_mem_isr_create(mss_mem_t hdl, uint16_t num_of_blocks);
+
+/**************************************************************************//**
+*
+* mss_mem_isr_create_static
+*
+* @brief      create an ISR side of a memory block list like
+*             mss_mem_isr_create with a hand back ring given by the caller
+*
+* @param[in]  ring            pointer to the hand back ring, shall have at
+*                             least MSS_MEM_ISR_RING_SIZE(num_of_blocks)
+*                             bytes (see MSS_MEM_ISR_RING_DEFINE)
+* @param[in]  hdl             memory blocks handle
+* @param[in]  num_of_blocks   number of memory blocks for the ISR
+*
+* @return     MSS_MEM_ISR_INVALID_HDL - failed to create the ISR side
+*             other - valid ISR side handle
+*
+* @remark     shall be called from a task before the ISR uses the ISR side.
+*             The memory blocks of the ISR side count as used blocks of the
+*             memory block list in mss_mem_stats.
+*
+******************************************************************************/
+mss_mem_isr_t mss_mem_isr_create_static(void* ring, mss_mem_t hdl,
+                                        uint16_t num_of_blocks);
+
+/**************************************************************************//**
+*
+* mss_mem_isr_alloc
+*
+* @brief      allocate a memory block from an ISR side without entering
+*             critical section
+*
+* @param[in]  hdl      ISR side handle
+*
+* @return     NULL if failed, otherwise pointer to the allocated memory block
+*
+* @remark     shall only be called from the one ISR which owns the ISR side.
+*             Other ISRs, also nested ones, and tasks do not touch its free
+*             block stack, so no critical section is needed.
+*
+******************************************************************************/
+void* mss_mem_isr_alloc(mss_mem_isr_t hdl);
+
+/**************************************************************************//**
+*
+* mss_mem_isr_free
+*
+* @brief      free a memory block allocated by an ISR side from its ISR
+*             without entering critical section
+*
+* @param[in]  hdl      ISR side handle
+* @param[in]  data     pointer of the data to be freed
+*
+* @return     -
+*
+* @remark     shall only be called from the one ISR which owns the ISR side,
+*             and only for memory blocks allocated from this ISR side
+*
+******************************************************************************/
+void mss_mem_isr_free(mss_mem_isr_t hdl, void* data);
+#endif /* (MSS_MAX_NUM_OF_MEM_ISR > 0) */
+
+/**************************************************************************//**
+*
+* mss_mem_check_block
+*
+* @brief      check whether a memory block belongs to a memory block list
+*
+* @param[in]  hdl      memory blocks handle
+* @param[in]  data     pointer of the data of the memory block
+*
+* @return     true if the memory block belongs to the memory block list
+*
+******************************************************************************/
+bool mss_mem_check_block(mss_mem_t hdl, void* data);
+
+#if (MSS_MEM_USE_STATS == TRUE)
+/**************************************************************************//**
+*
+* mss_mem_stats
+*
+* @brief      get the usage statistics of a memory block list
+*
+* @param[in]  hdl      memory blocks handle
+* @param[out] stats    buffer for storing the statistics
+*
+* @return     -
+*
+******************************************************************************/
+void mss_mem_stats(mss_mem_t hdl, mss_mem_stats_t* stats);
+#endif /* (MSS_MEM_USE_STATS == TRUE) */
+
+/**************************************************************************//**
+*
+* MSS_MEM_WAIT_ALLOC
+*
+* @brief      macro (blocking) function which waits until a memory block can
+*             be allocated
+*
+* @param[in]  hdl       memory blocks handle
+* @param[out] ptr       buffer for storing the pointer to the memory block
+* @param[in]  context   mss task context
+*
+* @return     -
+*
+******************************************************************************/
+#define MSS_MEM_WAIT_ALLOC(hdl, ptr, context)             \
+        do{while((ptr = mss_mem_wait_alloc(hdl)) == NULL) \
+           MSS_RETURN(context);}while(0)
+
 /** @} MSS Memory API Functions */
 
 /** @} MSS_Mem_API */
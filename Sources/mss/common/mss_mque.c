@@ -62,8 +62,25 @@
  *  mss mque block data type
  */
 struct mss_mque_tbl_t {
-  llist_t msg_list;
+  llist_head_t msg_list;
   uint8_t owner_task;
+#if (MSS_MQUE_USE_CAPACITY == TRUE)
+  uint16_t count;
+  uint16_t capacity;
+  mss_mque_policy_t policy;
+  mss_task_bits_t waiting_senders;
+#endif /* (MSS_MQUE_USE_CAPACITY == TRUE) */
+#if (MSS_MQUE_NUM_OF_PRIO > 1)
+  bool prio_order;
+  mss_mque_msg_t* prio_last[MSS_MQUE_NUM_OF_PRIO];
+#endif /* (MSS_MQUE_NUM_OF_PRIO > 1) */
+#if (MSS_MQUE_USE_WORKQ == TRUE)
+  mss_task_bits_t consumers;
+  mss_task_bits_t idle_consumers;
+#if (MSS_MQUE_WORKQ_ROUND_ROBIN == TRUE)
+  uint8_t last_consumer;
+#endif /* (MSS_MQUE_WORKQ_ROUND_ROBIN == TRUE) */
+#endif /* (MSS_MQUE_USE_WORKQ == TRUE) */
 };
 
 // number of created message queues
@@ -72,10 +89,42 @@ static uint8_t num_of_mque = 0;
 // message queue blocks
 static struct mss_mque_tbl_t mque_tbl[MSS_MAX_NUM_OF_MQUE];
 
+#if (MSS_MAX_NUM_OF_MQUE_RING > 0)
+/** mss_mque_ring_tbl_t
+ *  mss ring buffer mque block data type
+ */
+struct mss_mque_ring_tbl_t {
+  uint8_t *buf;
+  uint8_t elem_size;
+  uint8_t depth;
+  uint8_t head;
+  uint8_t count;
+  uint8_t owner_task;
+};
+
+// number of created ring buffer message queues
+static uint8_t num_of_mque_ring = 0;
+
+// ring buffer message queue blocks
+static struct mss_mque_ring_tbl_t mque_ring_tbl[MSS_MAX_NUM_OF_MQUE_RING];
+#endif /* (MSS_MAX_NUM_OF_MQUE_RING > 0) */
+
 //*****************************************************************************
 // Internal function declarations
 //*****************************************************************************
 
+static void mque_put(mss_mque_t hdl, mss_mque_msg_t* msg);
+static mss_mque_msg_t* mque_get(mss_mque_t hdl);
+static void mque_wakeup_receiver(mss_mque_t hdl);
+
+#if (MSS_MQUE_USE_CAPACITY == TRUE)
+static mss_mque_msg_t* mque_drop_oldest(mss_mque_t hdl, mss_mque_msg_t* msg);
+static void mque_wakeup_sender(mss_mque_t hdl);
+#endif /* (MSS_MQUE_USE_CAPACITY == TRUE) */
+
+#if (MSS_MAX_NUM_OF_MQUE_RING > 0)
+static void mque_copy(uint8_t *dst, const uint8_t *src, uint8_t len);
+#endif /* (MSS_MAX_NUM_OF_MQUE_RING > 0) */
 
 //*****************************************************************************
 // External functions
@@ -95,17 +144,45 @@ static struct mss_mque_tbl_t mque_tbl[MSS_MAX_NUM_OF_MQUE];
 mss_mque_t mss_mque_create(uint8_t owner_task_id)
 {
   mss_mque_t ret_hdl = MSS_MQUE_INVALID_HDL;
+#if (MSS_MQUE_NUM_OF_PRIO > 1)
+  uint8_t i;
+#endif /* (MSS_MQUE_NUM_OF_PRIO > 1) */
 
   // check if there is a free mque block
   if(num_of_mque < MSS_MAX_NUM_OF_MQUE)
   {
     // initializes message queue list
-	  mque_tbl[num_of_mque].msg_list = llist_create();
-	  MSS_DEBUG_CHECK(mque_tbl[num_of_mque].msg_list != LLIST_INVALID_HDL);
+	  llist_init(&mque_tbl[num_of_mque].msg_list);
 
     // set owner task
     mque_tbl[num_of_mque].owner_task = owner_task_id;
 
+  #if (MSS_MQUE_USE_CAPACITY == TRUE)
+    // unbounded message queue
+    mque_tbl[num_of_mque].count = 0;
+    mque_tbl[num_of_mque].capacity = 0;
+    mque_tbl[num_of_mque].policy = MSS_MQUE_DROP_NEWEST;
+    mque_tbl[num_of_mque].waiting_senders = 0;
+  #endif /* (MSS_MQUE_USE_CAPACITY == TRUE) */
+
+  #if (MSS_MQUE_NUM_OF_PRIO > 1)
+    // first in first out message queue
+    mque_tbl[num_of_mque].prio_order = false;
+    for(i=0 ; i<MSS_MQUE_NUM_OF_PRIO ; i++)
+    {
+      mque_tbl[num_of_mque].prio_last[i] = NULL;
+    }
+  #endif /* (MSS_MQUE_NUM_OF_PRIO > 1) */
+
+  #if (MSS_MQUE_USE_WORKQ == TRUE)
+    // no consumer tasks, only the owner task receives the messages
+    mque_tbl[num_of_mque].consumers = 0;
+    mque_tbl[num_of_mque].idle_consumers = 0;
+  #if (MSS_MQUE_WORKQ_ROUND_ROBIN == TRUE)
+    mque_tbl[num_of_mque].last_consumer = 0;
+  #endif /* (MSS_MQUE_WORKQ_ROUND_ROBIN == TRUE) */
+  #endif /* (MSS_MQUE_USE_WORKQ == TRUE) */
+
     // return valid handle and increment number of mque block
     ret_hdl = &mque_tbl[num_of_mque++];
   }
@@ -136,10 +213,13 @@ void mss_mque_send(mss_mque_t hdl, mss_mque_msg_t* msg)
   MSS_ENTER_CRITICAL_SECTION(int_flag);
 
   // insert data to mque linked read list
-  llist_add_last(hdl->msg_list, msg);
+  mque_put(hdl, msg);
+#if (MSS_MQUE_USE_CAPACITY == TRUE)
+  hdl->count++;
+#endif /* (MSS_MQUE_USE_CAPACITY == TRUE) */
 
   // wake up owner task
-  mss_activate_task_int(hdl->owner_task);
+  mque_wakeup_receiver(hdl);
 
   MSS_LEAVE_CRITICAL_SECTION(int_flag);
 }
@@ -158,14 +238,891 @@ void mss_mque_send(mss_mque_t hdl, mss_mque_msg_t* msg)
 ******************************************************************************/
 mss_mque_msg_t* mss_mque_read(mss_mque_t hdl)
 {
+  mss_mque_msg_t* msg;
+  mss_int_flag_t int_flag;
+
   // check task id
   MSS_DEBUG_CHECK(hdl != MSS_MQUE_INVALID_HDL);
 
-  return((mss_mque_msg_t*)llist_get_first(hdl->msg_list));
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  msg = mque_get(hdl);
+
+#if (MSS_MQUE_USE_WORKQ == TRUE)
+  if(hdl->consumers & mss_bitpos_to_bit[mss_running_task_id])
+  {
+    // a consumer task without message is idle and can get the next one
+    if(msg == NULL)
+    {
+      hdl->idle_consumers |= mss_bitpos_to_bit[mss_running_task_id];
+    }
+    else
+    {
+      hdl->idle_consumers &= ~mss_bitpos_to_bit[mss_running_task_id];
+    }
+  }
+#endif /* (MSS_MQUE_USE_WORKQ == TRUE) */
+
+#if (MSS_MQUE_USE_CAPACITY == TRUE)
+  if(msg != NULL)
+  {
+    hdl->count--;
+
+    // there is space now, wake up the waiting sender with highest priority
+    mque_wakeup_sender(hdl);
+  }
+#endif /* (MSS_MQUE_USE_CAPACITY == TRUE) */
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+
+  return msg;
 }
 
+/**************************************************************************//**
+*
+* mss_mque_read_all
+*
+* @brief      receive all messages from the message queue (mque) at once
+*
+* @param[in]  hdl     handle of the mque
+*
+* @return     pointer to the first message of the chain of all messages in
+*             the message queue, linked by their next pointers and
+*             terminated by NULL (NULL if no message available)
+*
+* @remark     the next pointer of a message shall be read before the message
+*             is freed or sent again
+*
+******************************************************************************/
+mss_mque_msg_t* mss_mque_read_all(mss_mque_t hdl)
+{
+  mss_mque_msg_t* msg;
+  mss_int_flag_t int_flag;
+#if (MSS_MQUE_NUM_OF_PRIO > 1)
+  uint8_t i;
+#endif /* (MSS_MQUE_NUM_OF_PRIO > 1) */
+
+  // check task id
+  MSS_DEBUG_CHECK(hdl != MSS_MQUE_INVALID_HDL);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  // detach the whole message chain
+  msg = (mss_mque_msg_t*)llist_get_all(&hdl->msg_list);
+
+#if (MSS_MQUE_NUM_OF_PRIO > 1)
+  for(i=0 ; i<MSS_MQUE_NUM_OF_PRIO ; i++)
+  {
+    hdl->prio_last[i] = NULL;
+  }
+#endif /* (MSS_MQUE_NUM_OF_PRIO > 1) */
+
+#if (MSS_MQUE_USE_WORKQ == TRUE)
+  if(hdl->consumers & mss_bitpos_to_bit[mss_running_task_id])
+  {
+    // a consumer task without message is idle and can get the next one
+    if(msg == NULL)
+    {
+      hdl->idle_consumers |= mss_bitpos_to_bit[mss_running_task_id];
+    }
+    else
+    {
+      hdl->idle_consumers &= ~mss_bitpos_to_bit[mss_running_task_id];
+    }
+  }
+#endif /* (MSS_MQUE_USE_WORKQ == TRUE) */
+
+#if (MSS_MQUE_USE_CAPACITY == TRUE)
+  if(msg != NULL)
+  {
+    hdl->count = 0;
+
+    // the queue is empty now, wake up all waiting senders
+    if(hdl->waiting_senders)
+    {
+      mss_activate_tasks_int(hdl->waiting_senders);
+      hdl->waiting_senders = 0;
+    }
+  }
+#endif /* (MSS_MQUE_USE_CAPACITY == TRUE) */
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+
+  return msg;
+}
+
+/**************************************************************************//**
+*
+* mss_mque_send_batch
+*
+* @brief      send a chain of messages, linked by their next pointers, to a
+*             message queue (mque) at once. The receiving task will be
+*             automatically activated.
+*
+* @param[in]  hdl     handle of the mque
+* @param[in]  first   pointer to the first message of the chain
+* @param[in]  last    pointer to the last message of the chain
+*
+* @return     true if the chain is sent, false if a bounded mque has no
+*             space for the whole chain (no message is sent)
+*
+* @remark     the chain is linked into the queue in constant time. A priority
+*             ordered mque links the messages one by one
+*
+******************************************************************************/
+bool mss_mque_send_batch(mss_mque_t hdl, mss_mque_msg_t* first,
+                         mss_mque_msg_t* last)
+{
+  bool ret = true;
+#if ((MSS_MQUE_USE_CAPACITY == TRUE) || (MSS_MQUE_USE_WORKQ == TRUE))
+  uint16_t num_of_msg = 1;
+#endif
+#if ((MSS_MQUE_USE_CAPACITY == TRUE) || (MSS_MQUE_USE_WORKQ == TRUE) || \
+     (MSS_MQUE_NUM_OF_PRIO > 1))
+  mss_mque_msg_t* msg;
+#endif
+  mss_int_flag_t int_flag;
+
+  // check parameters
+  MSS_DEBUG_CHECK((hdl != MSS_MQUE_INVALID_HDL) && (first != NULL) &&
+                  (last != NULL));
+
+#if ((MSS_MQUE_USE_CAPACITY == TRUE) || (MSS_MQUE_USE_WORKQ == TRUE))
+  // count the messages before entering critical section, the chain is not
+  // shared yet
+  for(msg = first ; msg != last ; msg = (mss_mque_msg_t*)msg->next)
+  {
+    num_of_msg++;
+  }
+#endif
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+#if (MSS_MQUE_USE_CAPACITY == TRUE)
+  // a bounded mque takes the whole chain or nothing
+  if((hdl->capacity != 0) && ((hdl->count >= hdl->capacity) ||
+                              (num_of_msg > (hdl->capacity - hdl->count))))
+  {
+    ret = false;
+  }
+#endif /* (MSS_MQUE_USE_CAPACITY == TRUE) */
+
+  if(ret)
+  {
+  #if (MSS_MQUE_NUM_OF_PRIO > 1)
+    if(hdl->prio_order)
+    {
+      // every message has to be linked according to its priority
+      last->next = NULL;
+      while(first != NULL)
+      {
+        msg = first;
+        first = (mss_mque_msg_t*)first->next;
+        mque_put(hdl, msg);
+      }
+    }
+    else
+  #endif /* (MSS_MQUE_NUM_OF_PRIO > 1) */
+    {
+      // link the whole chain at once
+      llist_add_chain_last(&hdl->msg_list, first, last);
+    }
+
+  #if (MSS_MQUE_USE_CAPACITY == TRUE)
+    hdl->count += num_of_msg;
+  #endif /* (MSS_MQUE_USE_CAPACITY == TRUE) */
+
+  #if (MSS_MQUE_USE_WORKQ == TRUE)
+    // wake up one idle consumer task for every message of a work queue
+    while((--num_of_msg > 0) && (hdl->idle_consumers))
+    {
+      mque_wakeup_receiver(hdl);
+    }
+  #endif /* (MSS_MQUE_USE_WORKQ == TRUE) */
+
+    // wake up owner task
+    mque_wakeup_receiver(hdl);
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+
+  return ret;
+}
+
+#if (MSS_MQUE_NUM_OF_PRIO > 1)
+/**************************************************************************//**
+*
+* mss_mque_create_prio
+*
+* @brief      create a new message queue which delivers the messages in order
+*             of their priority (prio member of mss_mque_msg_t, 0 is the
+*             highest priority), and in sending order within a priority
+*
+* @param      owner_task_id    task id of mque's owner task
+*
+* @return     handle to created mque, MSS_MQUE_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_mque_t mss_mque_create_prio(uint8_t owner_task_id)
+{
+  mss_mque_t ret_hdl;
+
+  ret_hdl = mss_mque_create(owner_task_id);
+  if(ret_hdl != MSS_MQUE_INVALID_HDL)
+  {
+    ret_hdl->prio_order = true;
+  }
+
+  return ret_hdl;
+}
+#endif /* (MSS_MQUE_NUM_OF_PRIO > 1) */
+
+#if (MSS_MQUE_USE_WORKQ == TRUE)
+/**************************************************************************//**
+*
+* mss_mque_create_workq
+*
+* @brief      create a new work queue, a message queue which distributes its
+*             messages to a set of consumer tasks (see mss_mque_add_consumer)
+*
+* @param      -
+*
+* @return     handle to created mque, MSS_MQUE_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_mque_t mss_mque_create_workq(void)
+{
+  return (mss_mque_create(MSS_INVALID_TASK_ID));
+}
+
+/**************************************************************************//**
+*
+* mss_mque_add_consumer
+*
+* @brief      add a consumer task to a work queue. Every message sent to the
+*             work queue activates one idle consumer task, which is a task
+*             whose last mss_mque_read on the work queue returned no message.
+*             Messages sent before the first consumer was added wait in the
+*             work queue and activate the first consumer
+*
+* @param[in]  hdl       handle of the mque
+* @param[in]  task_id   task id of the consumer task
+*
+* @return     -
+*
+******************************************************************************/
+void mss_mque_add_consumer(mss_mque_t hdl, uint8_t task_id)
+{
+  mss_int_flag_t int_flag;
+
+  // check parameters
+  MSS_DEBUG_CHECK((hdl != MSS_MQUE_INVALID_HDL) &&
+                  (task_id < MSS_NUM_OF_TASKS));
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  // new consumer is idle until it reads a message
+  hdl->consumers |= mss_bitpos_to_bit[task_id];
+  hdl->idle_consumers |= mss_bitpos_to_bit[task_id];
+
+  if(llist_touch_first(&hdl->msg_list) != NULL)
+  {
+    // messages are already waiting, let a consumer get them
+    mque_wakeup_receiver(hdl);
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+}
+#endif /* (MSS_MQUE_USE_WORKQ == TRUE) */
+
+#if (MSS_MQUE_USE_CAPACITY == TRUE)
+/**************************************************************************//**
+*
+* mss_mque_create_bounded
+*
+* @brief      create a new message queue which holds a limited number of
+*             messages
+*
+* @param[in]  owner_task_id    task id of mque's owner task
+* @param[in]  capacity         maximum number of messages in the queue for
+*                              mss_mque_try_send (zero means unbounded)
+* @param[in]  policy           which message is dropped by mss_mque_try_send
+*                              when the queue is full
+*
+* @return     handle to created mque, MSS_MQUE_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_mque_t mss_mque_create_bounded(uint8_t owner_task_id, uint16_t capacity,
+                                   mss_mque_policy_t policy)
+{
+  mss_mque_t ret_hdl;
+
+  ret_hdl = mss_mque_create(owner_task_id);
+  if(ret_hdl != MSS_MQUE_INVALID_HDL)
+  {
+    ret_hdl->capacity = capacity;
+    ret_hdl->policy = policy;
+  }
+
+  return ret_hdl;
+}
+
+#if (MSS_MQUE_NUM_OF_PRIO > 1)
+/**************************************************************************//**
+*
+* mss_mque_create_prio_bounded
+*
+* @brief      create a new message queue which delivers the messages in order
+*             of their priority like mss_mque_create_prio, and holds a
+*             limited number of messages like mss_mque_create_bounded
+*
+* @param[in]  owner_task_id    task id of mque's owner task
+* @param[in]  capacity         maximum number of messages in the queue for
+*                              mss_mque_try_send (zero means unbounded)
+* @param[in]  policy           which message is dropped by mss_mque_try_send
+*                              when the queue is full
+*
+* @return     handle to created mque, MSS_MQUE_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_mque_t mss_mque_create_prio_bounded(uint8_t owner_task_id,
+                                        uint16_t capacity,
+                                        mss_mque_policy_t policy)
+{
+  mss_mque_t ret_hdl;
+
+  ret_hdl = mss_mque_create_bounded(owner_task_id, capacity, policy);
+  if(ret_hdl != MSS_MQUE_INVALID_HDL)
+  {
+    ret_hdl->prio_order = true;
+  }
+
+  return ret_hdl;
+}
+#endif /* (MSS_MQUE_NUM_OF_PRIO > 1) */
+
+/**************************************************************************//**
+*
+* mss_mque_try_send
+*
+* @brief      send a message to a message queue (mque) if it is not full. The
+*             receiving task will be automatically activated. If the queue is
+*             full, either the new message (MSS_MQUE_DROP_NEWEST) or the
+*             oldest message in the queue (MSS_MQUE_DROP_OLDEST) is dropped.
+*             In a priority ordered mque MSS_MQUE_DROP_OLDEST drops the
+*             oldest message of the lowest priority in the queue, or the new
+*             message if its priority is lower than all queued messages.
+*             Can be called from ISR.
+*
+* @param[in]  hdl   handle of the mque
+* @param[in]  msg   pointer to the mque message to be sent
+*
+* @return     NULL if the message is queued without dropping another one,
+*             otherwise pointer to the dropped message (to be freed by the
+*             caller)
+*
+******************************************************************************/
+mss_mque_msg_t* mss_mque_try_send(mss_mque_t hdl, mss_mque_msg_t* msg)
+{
+  mss_mque_msg_t* ret = NULL;
+  mss_int_flag_t int_flag;
+
+  // check task id
+  MSS_DEBUG_CHECK(hdl != MSS_MQUE_INVALID_HDL);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  if((hdl->capacity == 0) || (hdl->count < hdl->capacity))
+  {
+    mque_put(hdl, msg);
+    hdl->count++;
+  }
+  else if(hdl->policy == MSS_MQUE_DROP_OLDEST)
+  {
+    // replace the oldest message with the new one
+    ret = mque_drop_oldest(hdl, msg);
+    if(ret != msg)
+    {
+      mque_put(hdl, msg);
+    }
+  }
+  else
+  {
+    // queue is full, drop the new message
+    ret = msg;
+  }
+
+  if(ret != msg)
+  {
+    // wake up owner task
+    mque_wakeup_receiver(hdl);
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+
+  return ret;
+}
+
+/**************************************************************************//**
+*
+* mss_mque_check_space
+*
+* @brief      check whether a message can be sent to a message queue without
+*             dropping a message. If the queue is full, the running task will
+*             be put into the waiting sender list and activated when the
+*             owner task reads a message
+*
+* @param[in]  hdl   handle of the mque
+*
+* @return     true if the queue is not full, false if it is full
+*
+******************************************************************************/
+bool mss_mque_check_space(mss_mque_t hdl)
+{
+  bool ret = true;
+  mss_int_flag_t int_flag;
+
+  // check task id
+  MSS_DEBUG_CHECK(hdl != MSS_MQUE_INVALID_HDL);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  if((hdl->capacity != 0) && (hdl->count >= hdl->capacity))
+  {
+    // queue is full, put task into waiting sender list
+    hdl->waiting_senders |= mss_bitpos_to_bit[mss_running_task_id];
+    ret = false;
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+
+  return ret;
+}
+#endif /* (MSS_MQUE_USE_CAPACITY == TRUE) */
+
+#if (MSS_MAX_NUM_OF_MQUE_RING > 0)
+/**************************************************************************//**
+*
+* mss_mque_ring_create
+*
+* @brief      create a new ring buffer message queue. The messages are copied
+*             into a fixed size buffer, no memory block and no link header
+*             is needed for every message
+*
+* @param[in]  owner_task_id    task id of mque's owner task
+* @param[in]  elem_size        size of a message in bytes
+* @param[in]  depth            maximum number of messages in the queue
+*
+* @return     handle to created mque, MSS_MQUE_RING_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_mque_ring_t mss_mque_ring_create(uint8_t owner_task_id,
+                                     uint8_t elem_size, uint8_t depth)
+{
+  mss_mque_ring_t ret_hdl = MSS_MQUE_RING_INVALID_HDL;
+  uint8_t *buf;
+
+  // check if there is a free ring buffer mque block
+  if(num_of_mque_ring < MSS_MAX_NUM_OF_MQUE_RING)
+  {
+    // try to allocate the message buffer dynamically
+    buf = MSS_MALLOC(MSS_MQUE_RING_BUF_SIZE(elem_size, depth));
+    MSS_DEBUG_CHECK(buf != NULL);
+
+    if(buf != NULL)
+    {
+      ret_hdl = mss_mque_ring_create_static(buf, owner_task_id, elem_size,
+                                            depth);
+    }
+  }
+
+  return ret_hdl;
+}
+
+/**************************************************************************//**
+*
+* mss_mque_ring_create_static
+*
+* @brief      create a new ring buffer message queue like mss_mque_ring_create
+*             in a message buffer given by the caller
+*
+* @param[in]  buf              pointer to the message buffer, shall have at
+*                              least MSS_MQUE_RING_BUF_SIZE(elem_size, depth)
+*                              bytes (see MSS_MQUE_RING_BUF_DEFINE)
+* @param[in]  owner_task_id    task id of mque's owner task
+* @param[in]  elem_size        size of a message in bytes
+* @param[in]  depth            maximum number of messages in the queue
+*
+* @return     handle to created mque, MSS_MQUE_RING_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_mque_ring_t mss_mque_ring_create_static(void* buf, uint8_t owner_task_id,
+                                            uint8_t elem_size, uint8_t depth)
+{
+  mss_mque_ring_t ret_hdl = MSS_MQUE_RING_INVALID_HDL;
+
+  // check parameters
+  MSS_DEBUG_CHECK((buf != NULL) && (elem_size > 0) && (depth > 0));
+
+  // check if there is a free ring buffer mque block
+  if(num_of_mque_ring < MSS_MAX_NUM_OF_MQUE_RING)
+  {
+    mque_ring_tbl[num_of_mque_ring].buf = (uint8_t*)buf;
+    mque_ring_tbl[num_of_mque_ring].elem_size = elem_size;
+    mque_ring_tbl[num_of_mque_ring].depth = depth;
+    mque_ring_tbl[num_of_mque_ring].head = 0;
+    mque_ring_tbl[num_of_mque_ring].count = 0;
+    mque_ring_tbl[num_of_mque_ring].owner_task = owner_task_id;
+
+    // return valid handle and increment number of ring buffer mque block
+    ret_hdl = &mque_ring_tbl[num_of_mque_ring++];
+  }
+
+  return ret_hdl;
+}
+
+/**************************************************************************//**
+*
+* mss_mque_ring_send
+*
+* @brief      copy a message into a ring buffer message queue. The receiving
+*             task will be automatically activated.
+*
+* @param[in]  hdl    handle of the ring buffer mque
+* @param[in]  data   pointer to the message data (elem_size bytes)
+*
+* @return     true if success, false if the queue is full
+*
+******************************************************************************/
+bool mss_mque_ring_send(mss_mque_ring_t hdl, const void* data)
+{
+  bool ret = false;
+  uint8_t tail;
+  mss_int_flag_t int_flag;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_MQUE_RING_INVALID_HDL);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  if(hdl->count < hdl->depth)
+  {
+    // get the free slot after the newest message
+    tail = hdl->head + hdl->count;
+    if(tail >= hdl->depth)
+    {
+      tail -= hdl->depth;
+    }
+
+    // copy the message into the slot
+    mque_copy(&hdl->buf[(uint16_t)tail * hdl->elem_size],
+              (const uint8_t*)data, hdl->elem_size);
+    hdl->count++;
+
+    // wake up owner task
+    mss_activate_task_int(hdl->owner_task);
+
+    ret = true;
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+
+  return ret;
+}
+
+/**************************************************************************//**
+*
+* mss_mque_ring_read
+*
+* @brief      copy the oldest message out of a ring buffer message queue and
+*             remove it from the queue
+*
+* @param[in]  hdl    handle of the ring buffer mque
+* @param[out] data   buffer for the message data (elem_size bytes)
+*
+* @return     true if a message is read, false if the queue is empty
+*
+******************************************************************************/
+bool mss_mque_ring_read(mss_mque_ring_t hdl, void* data)
+{
+  bool ret = false;
+  mss_int_flag_t int_flag;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_MQUE_RING_INVALID_HDL);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  if(hdl->count > 0)
+  {
+    // copy the oldest message out of the buffer
+    mque_copy((uint8_t*)data, &hdl->buf[(uint16_t)hdl->head * hdl->elem_size],
+              hdl->elem_size);
+
+    // remove the message from the buffer
+    if(++hdl->head >= hdl->depth)
+    {
+      hdl->head = 0;
+    }
+    hdl->count--;
+
+    ret = true;
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+
+  return ret;
+}
+#endif /* (MSS_MAX_NUM_OF_MQUE_RING > 0) */
+
 //*****************************************************************************
 // Internal functions
 //*****************************************************************************
 
+#if (MSS_MAX_NUM_OF_MQUE_RING > 0)
+/**************************************************************************//**
+*
+* mque_copy
+*
+* @brief      copy message data bytes
+*
+* @param[out] dst    destination buffer
+* @param[in]  src    source buffer
+* @param[in]  len    number of bytes to be copied
+*
+* @return     -
+*
+******************************************************************************/
+static void mque_copy(uint8_t *dst, const uint8_t *src, uint8_t len)
+{
+  while(len--)
+  {
+    *dst++ = *src++;
+  }
+}
+#endif /* (MSS_MAX_NUM_OF_MQUE_RING > 0) */
+
+/**************************************************************************//**
+*
+* mque_put
+*
+* @brief      put a message into the message list of a mque - not reentrant.
+*             In a priority ordered mque, the message is linked after the
+*             last message with the same or higher priority, which is known
+*             for every priority
+*
+* @param[in]  hdl   handle of the mque
+* @param[in]  msg   pointer to the mque message
+*
+* @return     -
+*
+******************************************************************************/
+static void mque_put(mss_mque_t hdl, mss_mque_msg_t* msg)
+{
+#if (MSS_MQUE_NUM_OF_PRIO > 1)
+  mss_mque_msg_t* prev_msg = NULL;
+  uint8_t prio;
+
+  if(hdl->prio_order)
+  {
+    MSS_DEBUG_CHECK(msg->prio < MSS_MQUE_NUM_OF_PRIO);
+
+    // search the last message with the same or the next higher priority
+    for(prio = msg->prio + 1 ; prio > 0 ; prio--)
+    {
+      if(hdl->prio_last[prio - 1] != NULL)
+      {
+        prev_msg = hdl->prio_last[prio - 1];
+        break;
+      }
+    }
+
+    llist_insert_after(&hdl->msg_list, prev_msg, msg);
+    hdl->prio_last[msg->prio] = msg;
+  }
+  else
+#endif /* (MSS_MQUE_NUM_OF_PRIO > 1) */
+  {
+    // constant time, the list keeps a pointer to its last object
+    llist_add_last(&hdl->msg_list, msg);
+  }
+}
+
+/**************************************************************************//**
+*
+* mque_get
+*
+* @brief      remove and return the first message of a mque - not reentrant
+*
+* @param[in]  hdl   handle of the mque
+*
+* @return     pointer to the first message, NULL if no message available
+*
+******************************************************************************/
+static mss_mque_msg_t* mque_get(mss_mque_t hdl)
+{
+  mss_mque_msg_t* msg;
+
+  msg = (mss_mque_msg_t*)llist_get_first(&hdl->msg_list);
+
+#if (MSS_MQUE_NUM_OF_PRIO > 1)
+  if((hdl->prio_order) && (msg != NULL) &&
+     (hdl->prio_last[msg->prio] == msg))
+  {
+    // the last message of its priority is gone
+    hdl->prio_last[msg->prio] = NULL;
+  }
+#endif /* (MSS_MQUE_NUM_OF_PRIO > 1) */
+
+  return msg;
+}
+
+#if (MSS_MQUE_USE_CAPACITY == TRUE)
+/**************************************************************************//**
+*
+* mque_drop_oldest
+*
+* @brief      remove the message to be dropped from a full mque for the
+*             MSS_MQUE_DROP_OLDEST policy - not reentrant. This is the first
+*             message, or in a priority ordered mque the oldest message of
+*             the lowest priority in the queue. If the new message has a
+*             lower priority than all queued messages, it is dropped itself
+*
+* @param[in]  hdl   handle of the mque
+* @param[in]  msg   pointer to the new mque message
+*
+* @return     pointer to the dropped message, msg if the new message shall
+*             be dropped
+*
+******************************************************************************/
+static mss_mque_msg_t* mque_drop_oldest(mss_mque_t hdl, mss_mque_msg_t* msg)
+{
+  mss_mque_msg_t* ret;
+#if (MSS_MQUE_NUM_OF_PRIO > 1)
+  uint8_t prio, low_prio;
+
+  if(hdl->prio_order)
+  {
+    // search the lowest priority in the queue
+    for(low_prio = MSS_MQUE_NUM_OF_PRIO - 1 ;
+        (low_prio > 0) && (hdl->prio_last[low_prio] == NULL) ; low_prio--);
+
+    if(msg->prio > low_prio)
+    {
+      // the new message has the lowest priority
+      ret = msg;
+    }
+    else
+    {
+      // the oldest message of a priority follows the last message of the
+      // next higher priority in the queue
+      ret = (mss_mque_msg_t*)llist_touch_first(&hdl->msg_list);
+      for(prio = low_prio ; prio > 0 ; prio--)
+      {
+        if(hdl->prio_last[prio - 1] != NULL)
+        {
+          ret = (mss_mque_msg_t*)hdl->prio_last[prio - 1]->next;
+          break;
+        }
+      }
+
+      llist_remove(&hdl->msg_list, ret);
+      if(hdl->prio_last[low_prio] == ret)
+      {
+        // the last message of its priority is gone
+        hdl->prio_last[low_prio] = NULL;
+      }
+    }
+  }
+  else
+#endif /* (MSS_MQUE_NUM_OF_PRIO > 1) */
+  {
+    // the first message is the oldest one
+    ret = mque_get(hdl);
+  }
+
+  return ret;
+}
+#endif /* (MSS_MQUE_USE_CAPACITY == TRUE) */
+
+/**************************************************************************//**
+*
+* mque_wakeup_receiver
+*
+* @brief      activate the task which shall receive a new message: the owner
+*             task, or for a work queue an idle consumer task if there is
+*             one - not reentrant
+*
+* @param[in]  hdl   handle of the mque
+*
+* @return     -
+*
+******************************************************************************/
+static void mque_wakeup_receiver(mss_mque_t hdl)
+{
+#if (MSS_MQUE_USE_WORKQ == TRUE)
+  mss_task_bits_t task_bits;
+  uint8_t task_id;
+
+  if(hdl->consumers)
+  {
+    task_bits = hdl->idle_consumers;
+  #if (MSS_MQUE_WORKQ_ROUND_ROBIN == TRUE)
+    // prefer the idle consumers after the last chosen one
+    if(task_bits & (mss_task_bits_t)
+         ~((mss_task_bits_t)(mss_bitpos_to_bit[hdl->last_consumer] << 1) - 1))
+    {
+      task_bits &= (mss_task_bits_t)
+         ~((mss_task_bits_t)(mss_bitpos_to_bit[hdl->last_consumer] << 1) - 1);
+    }
+  #endif /* (MSS_MQUE_WORKQ_ROUND_ROBIN == TRUE) */
+
+    // if all consumers are busy, the first one which reads again gets the
+    // message
+    if(task_bits)
+    {
+      // claim the idle consumer with the highest priority
+      task_id = mss_get_highest_prio_task(task_bits);
+      hdl->idle_consumers &= ~mss_bitpos_to_bit[task_id];
+    #if (MSS_MQUE_WORKQ_ROUND_ROBIN == TRUE)
+      hdl->last_consumer = task_id;
+    #endif /* (MSS_MQUE_WORKQ_ROUND_ROBIN == TRUE) */
+      mss_activate_task_int(task_id);
+    }
+  }
+  else
+#endif /* (MSS_MQUE_USE_WORKQ == TRUE) */
+  // a work queue without consumer keeps the message for the first one
+  if(hdl->owner_task != MSS_INVALID_TASK_ID)
+  {
+    mss_activate_task_int(hdl->owner_task);
+  }
+}
+
+#if (MSS_MQUE_USE_CAPACITY == TRUE)
+/**************************************************************************//**
+*
+* mque_wakeup_sender
+*
+* @brief      activate the waiting sender task with the highest priority -
+*             not reentrant
+*
+* @param[in]  hdl   handle of the mque
+*
+* @return     -
+*
+******************************************************************************/
+static void mque_wakeup_sender(mss_mque_t hdl)
+{
+  uint8_t task_id;
+
+  if(hdl->waiting_senders)
+  {
+    task_id = mss_get_highest_prio_task(hdl->waiting_senders);
+    hdl->waiting_senders &= ~mss_bitpos_to_bit[task_id];
+    mss_activate_task_int(task_id);
+  }
+}
+#endif /* (MSS_MQUE_USE_CAPACITY == TRUE) */
+
 #endif /* (MSS_TASK_USE_MQUE == TRUE) */
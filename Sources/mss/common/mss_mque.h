@@ -81,6 +81,30 @@ typedef struct mss_mque_tbl_t*      mss_mque_t;
  */
 #define MSS_MQUE_INVALID_HDL    ((mss_mque_t)NULL)
 
+#if (MSS_MAX_NUM_OF_MQUE_RING > 0)
+/** mss_mque_ring_t
+ *  mss ring buffer mque handle data type
+ */
+typedef struct mss_mque_ring_tbl_t* mss_mque_ring_t;
+
+/** MSS_MQUE_RING_INVALID_HDL
+ *  invalid ring buffer mque handle
+ */
+#define MSS_MQUE_RING_INVALID_HDL   ((mss_mque_ring_t)NULL)
+
+/** MSS_MQUE_RING_BUF_SIZE
+ *  size of the message buffer needed by mss_mque_ring_create_static in bytes
+ */
+#define MSS_MQUE_RING_BUF_SIZE(elem_size, depth)                           \
+        ((uint16_t)(elem_size) * (depth))
+
+/** MSS_MQUE_RING_BUF_DEFINE
+ *  define the message buffer for mss_mque_ring_create_static at compile time
+ */
+#define MSS_MQUE_RING_BUF_DEFINE(name, elem_size, depth)                   \
+        static uint8_t name[MSS_MQUE_RING_BUF_SIZE(elem_size, depth)]
+#endif /* (MSS_MAX_NUM_OF_MQUE_RING > 0) */
+
 /** @} MSS Message Queue handle */
 
 /**
@@ -94,10 +118,28 @@ typedef struct mss_mque_tbl_t*      mss_mque_t;
 typedef struct {
   /** pointer variable for putting message into linked list */
   void *next;
+#if (MSS_MQUE_NUM_OF_PRIO > 1)
+  /** message priority (0 is the highest), only used by priority ordered
+   *  mque */
+  uint8_t prio;
+#endif /* (MSS_MQUE_NUM_OF_PRIO > 1) */
   /** message data array */
   uint8_t data [1];
 }mss_mque_msg_t;
 
+#if (MSS_MQUE_USE_CAPACITY == TRUE)
+/** mss_mque_policy_t
+ *  which message is dropped by mss_mque_try_send when a bounded mque is full
+ */
+typedef enum {
+  /** the new message is not queued */
+  MSS_MQUE_DROP_NEWEST,
+  /** the oldest message in the queue is replaced by the new message, in a
+   *  priority ordered queue the oldest message of the lowest priority */
+  MSS_MQUE_DROP_OLDEST
+} mss_mque_policy_t;
+#endif /* (MSS_MQUE_USE_CAPACITY == TRUE) */
+
 /** @} MSS Message Queue data type */
 
 
@@ -135,6 +177,9 @@ mss_mque_t mss_mque_create(uint8_t owner_task_id);
 *
 * @return     -
 *
+* @remark     the capacity of a bounded mque is not checked, use
+*             mss_mque_try_send for bounded mque
+*
 ******************************************************************************/
 void mss_mque_send(mss_mque_t hdl, mss_mque_msg_t* msg);
 
@@ -152,6 +197,248 @@ void mss_mque_send(mss_mque_t hdl, mss_mque_msg_t* msg);
 ******************************************************************************/
 mss_mque_msg_t* mss_mque_read(mss_mque_t hdl);
 
+/**************************************************************************//**
+*
+* mss_mque_read_all
+*
+* @brief      receive all messages from the message queue (mque) at once
+*
+* @param[in]  hdl     handle of the mque
+*
+* @return     pointer to the first message of the chain of all messages in
+*             the message queue, linked by their next pointers and
+*             terminated by NULL (NULL if no message available)
+*
+* @remark     the next pointer of a message shall be read before the message
+*             is freed or sent again
+*
+******************************************************************************/
+mss_mque_msg_t* mss_mque_read_all(mss_mque_t hdl);
+
+/**************************************************************************//**
+*
+* mss_mque_send_batch
+*
+* @brief      send a chain of messages, linked by their next pointers, to a
+*             message queue (mque) at once. The receiving task will be
+*             automatically activated.
+*
+* @param[in]  hdl     handle of the mque
+* @param[in]  first   pointer to the first message of the chain
+* @param[in]  last    pointer to the last message of the chain
+*
+* @return     true if the chain is sent, false if a bounded mque has no
+*             space for the whole chain (no message is sent)
+*
+* @remark     the chain is linked into the queue in constant time. A priority
+*             ordered mque links the messages one by one
+*
+******************************************************************************/
+bool mss_mque_send_batch(mss_mque_t hdl, mss_mque_msg_t* first,
+                         mss_mque_msg_t* last);
+
+#if (MSS_MQUE_NUM_OF_PRIO > 1)
+/**************************************************************************//**
+*
+* mss_mque_create_prio
+*
+* @brief      create a new message queue which delivers the messages in order
+*             of their priority (prio member of mss_mque_msg_t, 0 is the
+*             highest priority), and in sending order within a priority
+*
+* @param      owner_task_id    task id of mque's owner task
+*
+* @return     handle to created mque, MSS_MQUE_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_mque_t mss_mque_create_prio(uint8_t owner_task_id);
+#endif /* (MSS_MQUE_NUM_OF_PRIO > 1) */
+
+#if (MSS_MQUE_USE_WORKQ == TRUE)
+/**************************************************************************//**
+*
+* mss_mque_create_workq
+*
+* @brief      create a new work queue, a message queue which distributes its
+*             messages to a set of consumer tasks (see mss_mque_add_consumer)
+*
+* @param      -
+*
+* @return     handle to created mque, MSS_MQUE_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_mque_t mss_mque_create_workq(void);
+
+/**************************************************************************//**
+*
+* mss_mque_add_consumer
+*
+* @brief      add a consumer task to a work queue. Every message sent to the
+*             work queue activates one idle consumer task, which is a task
+*             whose last mss_mque_read on the work queue returned no message
+*
+* @param[in]  hdl       handle of the mque
+* @param[in]  task_id   task id of the consumer task
+*
+* @return     -
+*
+******************************************************************************/
+void mss_mque_add_consumer(mss_mque_t hdl, uint8_t task_id);
+#endif /* (MSS_MQUE_USE_WORKQ == TRUE) */
+
+#if (MSS_MQUE_USE_CAPACITY == TRUE)
+/**************************************************************************//**
+*
+* mss_mque_create_bounded
+*
+* @brief      create a new message queue which holds a limited number of
+*             messages
+*
+* @param[in]  owner_task_id    task id of mque's owner task
+* @param[in]  capacity         maximum number of messages in the queue for
+*                              mss_mque_try_send (zero means unbounded)
+* @param[in]  policy           which message is dropped by mss_mque_try_send
+*                              when the queue is full
+*
+* @return     handle to created mque, MSS_MQUE_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_mque_t mss_mque_create_bounded(uint8_t owner_task_id, uint16_t capacity,
+                                   mss_mque_policy_t policy);
+
+#if (MSS_MQUE_NUM_OF_PRIO > 1)
+/**************************************************************************//**
+*
+* mss_mque_create_prio_bounded
+*
+* @brief      create a new message queue which delivers the messages in order
+*             of their priority like mss_mque_create_prio, and holds a
+*             limited number of messages like mss_mque_create_bounded
+*
+* @param[in]  owner_task_id    task id of mque's owner task
+* @param[in]  capacity         maximum number of messages in the queue for
+*                              mss_mque_try_send (zero means unbounded)
+* @param[in]  policy           which message is dropped by mss_mque_try_send
+*                              when the queue is full
+*
+* @return     handle to created mque, MSS_MQUE_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_mque_t mss_mque_create_prio_bounded(uint8_t owner_task_id,
+                                        uint16_t capacity,
+                                        mss_mque_policy_t policy);
+#endif /* (MSS_MQUE_NUM_OF_PRIO > 1) */
+
+/**************************************************************************//**
+*
+* mss_mque_try_send
+*
+* @brief      send a message to a message queue (mque) if it is not full. The
+*             receiving task will be automatically activated. If the queue is
+*             full, either the new message (MSS_MQUE_DROP_NEWEST) or the
+*             oldest message in the queue (MSS_MQUE_DROP_OLDEST) is dropped.
+*             In a priority ordered mque MSS_MQUE_DROP_OLDEST drops the
+*             oldest message of the lowest priority in the queue, or the new
+*             message if its priority is lower than all queued messages.
+*             Can be called from ISR.
+*
+* @param[in]  hdl   handle of the mque
+* @param[in]  msg   pointer to the mque message to be sent
+*
+* @return     NULL if the message is queued without dropping another one,
+*             otherwise pointer to the dropped message (to be freed by the
+*             caller)
+*
+******************************************************************************/
+mss_mque_msg_t* mss_mque_try_send(mss_mque_t hdl, mss_mque_msg_t* msg);
+
+/**************************************************************************//**
+*
+* mss_mque_check_space
+*
+* @brief      check whether a message can be sent to a message queue without
+*             dropping a message. If the queue is full, the running task will
+*             be put into the waiting sender list and activated when the
+*             owner task reads a message
+*
+* @param[in]  hdl   handle of the mque
+*
+* @return     true if the queue is not full, false if it is full
+*
+******************************************************************************/
+bool mss_mque_check_space(mss_mque_t hdl);
+#endif /* (MSS_MQUE_USE_CAPACITY == TRUE) */
+
+#if (MSS_MAX_NUM_OF_MQUE_RING > 0)
+/**************************************************************************//**
+*
+* mss_mque_ring_create
+*
+* @brief      create a new ring buffer message queue. The messages are copied
+*             into a fixed size buffer, no memory block and no link header
+*             is needed for every message
+*
+* @param[in]  owner_task_id    task id of mque's owner task
+* @param[in]  elem_size        size of a message in bytes
+* @param[in]  depth            maximum number of messages in the queue
+*
+* @return     handle to created mque, MSS_MQUE_RING_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_mque_ring_t mss_mque_ring_create(uint8_t owner_task_id,
+                                     uint8_t elem_size, uint8_t depth);
+
+/**************************************************************************//**
+*
+* mss_mque_ring_create_static
+*
+* @brief      create a new ring buffer message queue like mss_mque_ring_create
+*             in a message buffer given by the caller
+*
+* @param[in]  buf              pointer to the message buffer, shall have at
+*                              least MSS_MQUE_RING_BUF_SIZE(elem_size, depth)
+*                              bytes (see MSS_MQUE_RING_BUF_DEFINE)
+* @param[in]  owner_task_id    task id of mque's owner task
+* @param[in]  elem_size        size of a message in bytes
+* @param[in]  depth            maximum number of messages in the queue
+*
+* @return     handle to created mque, MSS_MQUE_RING_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_mque_ring_t mss_mque_ring_create_static(void* buf, uint8_t owner_task_id,
+                                            uint8_t elem_size, uint8_t depth);
+
+/**************************************************************************//**
+*
+* mss_mque_ring_send
+*
+* @brief      copy a message into a ring buffer message queue. The receiving
+*             task will be automatically activated.
+*
+* @param[in]  hdl    handle of the ring buffer mque
+* @param[in]  data   pointer to the message data (elem_size bytes)
+*
+* @return     true if success, false if the queue is full
+*
+******************************************************************************/
+bool mss_mque_ring_send(mss_mque_ring_t hdl, const void* data);
+
+/**************************************************************************//**
+*
+* mss_mque_ring_read
+*
+* @brief      copy the oldest message out of a ring buffer message queue and
+*             remove it from the queue
+*
+* @param[in]  hdl    handle of the ring buffer mque
+* @param[out] data   buffer for the message data (elem_size bytes)
+*
+* @return     true if a message is read, false if the queue is empty
+*
+******************************************************************************/
+bool mss_mque_ring_read(mss_mque_ring_t hdl, void* data);
+#endif /* (MSS_MAX_NUM_OF_MQUE_RING > 0) */
+
 /**************************************************************************//**
 *
 * MSS_MQUE_WAIT_MSG
@@ -170,6 +457,77 @@ mss_mque_msg_t* mss_mque_read(mss_mque_t hdl);
         do{while((msg = mss_mque_read(hdl)) == NULL) \
            MSS_RETURN(context);}while(0)
 
+#if (MSS_TASK_USE_TIMEOUT == TRUE)
+/**************************************************************************//**
+*
+* MSS_MQUE_WAIT_MSG_TIMEOUT
+*
+* @brief      macro (blocking) function to wait until a message is received
+*             in the message queue of an active mss task, or until the
+*             timeout expires
+*
+* @param[in]  hdl       handle of the mque block
+* @param[out] msg       pointer to the received message in mque, NULL if
+*                       timeout
+* @param[in]  tick      timeout in timer ticks (shall be greater than zero,
+*                       an invalid value times out immediately)
+* @param[in]  context   mss task context
+*
+* @return     -
+*
+******************************************************************************/
+#define MSS_MQUE_WAIT_MSG_TIMEOUT(hdl, msg, tick, context)  \
+        do{mss_timeout_start(tick);                         \
+           while((msg = mss_mque_read(hdl)) == NULL)        \
+           {                                                \
+             if(mss_timeout_check_expired())                \
+             {                                              \
+               break;                                       \
+             }                                              \
+             MSS_RETURN(context);                           \
+           }                                                \
+           mss_timeout_stop();}while(0)
+#endif /* (MSS_TASK_USE_TIMEOUT == TRUE) */
+
+#if (MSS_MQUE_USE_CAPACITY == TRUE)
+/**************************************************************************//**
+*
+* MSS_MQUE_WAIT_SPACE
+*
+* @brief      macro (blocking) function to wait until a bounded message queue
+*             has space for a new message
+*
+* @param[in]  hdl       handle of the mque block
+* @param[in]  context   mss task context
+*
+* @return     -
+*
+******************************************************************************/
+#define MSS_MQUE_WAIT_SPACE(hdl, context)              \
+        do{while(mss_mque_check_space(hdl) == false)   \
+           MSS_RETURN(context);}while(0)
+#endif /* (MSS_MQUE_USE_CAPACITY == TRUE) */
+
+#if (MSS_MAX_NUM_OF_MQUE_RING > 0)
+/**************************************************************************//**
+*
+* MSS_MQUE_RING_WAIT_MSG
+*
+* @brief      macro (blocking) function to wait until a message is received
+*             in the ring buffer message queue of an active mss task
+*
+* @param[in]  hdl       handle of the ring buffer mque
+* @param[out] data      buffer for the received message data
+* @param[in]  context   mss task context
+*
+* @return     -
+*
+******************************************************************************/
+#define MSS_MQUE_RING_WAIT_MSG(hdl, data, context)          \
+        do{while(mss_mque_ring_read(hdl, data) == false)    \
+           MSS_RETURN(context);}while(0)
+#endif /* (MSS_MAX_NUM_OF_MQUE_RING > 0) */
+
 /** @} MSS Message Queue API Functions */
 
 /** @} MSS_Mque_API */
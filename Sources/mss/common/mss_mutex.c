@@ -0,0 +1,272 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     mss_mutex.c
+* 
+* @brief    mcu simple scheduler mutex module
+*
+* @version  0.2.1
+*
+* @author   Leo Hendrawan
+* 
+* @remark   this will be included in compilation only if MSS_TASK_USE_MUTEX
+*           defined as TRUE
+* 
+******************************************************************************/
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+#include "mss.h"
+#include "mss_int.h"
+
+#if (MSS_TASK_USE_MUTEX == TRUE)
+
+//*****************************************************************************
+// Global variables 
+//*****************************************************************************
+
+//*****************************************************************************
+// Macros (defines), data types, static variables
+//*****************************************************************************
+
+/** mss_mutex_t
+ *  mss mutex table data type
+ */
+struct mss_mutex_tbl_t{
+  uint8_t owner_task;
+  uint8_t lock_cnt;
+  uint8_t ceiling;
+  mss_task_bits_t waiting_tasks;
+};
+
+// number of created mutexes
+static uint8_t num_of_mutex = 0;
+
+// mutex table
+static struct mss_mutex_tbl_t mutex_tbl[MSS_MAX_NUM_OF_MUTEX];
+
+//*****************************************************************************
+// Internal function declarations
+//*****************************************************************************
+
+static uint8_t mutex_get_running_prio(void);
+
+//*****************************************************************************
+// External functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* mss_mutex_create
+*
+* @brief      create a new (unlocked) mutex
+*
+* @param[in]  ceiling    priority ceiling of the mutex, which is the task id
+*                        of the highest priority task locking the mutex
+*
+* @return     handle to created mutex, MSS_MUTEX_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_mutex_t mss_mutex_create(uint8_t ceiling)
+{
+  mss_mutex_t ret_hdl = MSS_MUTEX_INVALID_HDL;
+
+  // check ceiling
+  MSS_DEBUG_CHECK(ceiling < MSS_NUM_OF_TASKS);
+
+  // check if there is a free mutex block
+  if(num_of_mutex < MSS_MAX_NUM_OF_MUTEX)
+  {
+    // initialize mutex block as unlocked
+    mutex_tbl[num_of_mutex].owner_task = MSS_INVALID_TASK_ID;
+    mutex_tbl[num_of_mutex].lock_cnt = 0;
+    mutex_tbl[num_of_mutex].ceiling = ceiling;
+    mutex_tbl[num_of_mutex].waiting_tasks = 0;
+
+    // return handle and increment number of mutex block
+    ret_hdl = &mutex_tbl[num_of_mutex++];
+  }
+
+  return ret_hdl;
+}
+
+/**************************************************************************//**
+*
+* mss_mutex_lock
+*
+* @brief      lock a mutex. The owner task can lock the mutex again
+*             (recursively). While the mutex is locked, the owner task runs
+*             with the ceiling priority of the mutex, so that it can not be
+*             preempted by any other task using the mutex. When the mutex is
+*             owned by another task, the running task will be put into
+*             waiting task list
+*
+* @param[in]  hdl        mutex handle
+*
+* @return     if true mutex is successfully locked, if false mutex is owned
+*             by another task
+*
+* @remark     the mutex can only be owned by another task if the owner task
+*             has returned to the scheduler without unlocking it. The
+*             priority ceiling is not applied while the owner task is not
+*             running
+*
+******************************************************************************/
+bool mss_mutex_lock(mss_mutex_t hdl)
+{
+  bool ret = false;
+  mss_int_flag_t int_flag;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_MUTEX_INVALID_HDL);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  if((hdl->owner_task == MSS_INVALID_TASK_ID) ||
+     (hdl->owner_task == mss_running_task_id))
+  {
+    // mutex is free, or owned (or just handed over) by the running task
+    if(hdl->lock_cnt == 0)
+    {
+      // only tasks up to the ceiling priority shall lock the mutex
+      MSS_DEBUG_CHECK(mss_running_task_id >= hdl->ceiling);
+      hdl->owner_task = mss_running_task_id;
+
+      // raise the priority of the running task to the ceiling
+      if(hdl->ceiling < mss_running_task_prio)
+      {
+        mss_set_running_prio_int(hdl->ceiling);
+      }
+    }
+
+    MSS_DEBUG_CHECK(hdl->lock_cnt < 0xFF);
+    hdl->lock_cnt++;
+    ret = true;
+  }
+  else
+  {
+    // mutex is owned by other task, put running task into waiting list
+    hdl->waiting_tasks |= mss_bitpos_to_bit[mss_running_task_id];
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+
+  return ret;
+}
+
+/**************************************************************************//**
+*
+* mss_mutex_unlock
+*
+* @brief      unlock a mutex, shall be called by the owner task as many times
+*             as it has locked the mutex. When the mutex is released, the
+*             ownership is handed over to the waiting task with the highest
+*             priority, which will be activated, and the owner task gets
+*             back its priority without the ceiling of the mutex
+*
+* @param[in]  hdl        mutex handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_mutex_unlock(mss_mutex_t hdl)
+{
+  uint8_t waiting_task_id;
+  mss_int_flag_t int_flag;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_MUTEX_INVALID_HDL);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  // only the owner task can unlock the mutex
+  MSS_DEBUG_CHECK((hdl->owner_task == mss_running_task_id) &&
+                  (hdl->lock_cnt > 0));
+
+  if(--hdl->lock_cnt == 0)
+  {
+    if(hdl->waiting_tasks)
+    {
+      // hand over the mutex to the waiting task with highest priority, it
+      // completes the locking with its lock counter when it runs again
+      waiting_task_id = mss_get_highest_prio_task(hdl->waiting_tasks);
+      hdl->waiting_tasks &= ~mss_bitpos_to_bit[waiting_task_id];
+      hdl->owner_task = waiting_task_id;
+      mss_activate_task_int(waiting_task_id);
+    }
+    else
+    {
+      // mutex is free
+      hdl->owner_task = MSS_INVALID_TASK_ID;
+    }
+
+    // drop the ceiling of the mutex, tasks which became ready in the
+    // meantime can preempt the running task now
+    mss_set_running_prio_int(mutex_get_running_prio());
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+}
+
+//*****************************************************************************
+// Internal functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* mutex_get_running_prio
+*
+* @brief      get the priority of the running task from its own priority and
+*             the ceiling of the mutexes it still has locked - not reentrant
+*
+* @param      -
+*
+* @return     priority of the running task
+*
+******************************************************************************/
+static uint8_t mutex_get_running_prio(void)
+{
+  uint8_t i, prio = mss_running_task_id;
+
+  for(i=0 ; i<num_of_mutex ; i++)
+  {
+    if((mutex_tbl[i].owner_task == mss_running_task_id) &&
+       (mutex_tbl[i].lock_cnt > 0) && (mutex_tbl[i].ceiling < prio))
+    {
+      prio = mutex_tbl[i].ceiling;
+    }
+  }
+
+  return prio;
+}
+
+#endif /* (MSS_TASK_USE_MUTEX == TRUE) */
@@ -0,0 +1,163 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     mss_mutex.h
+* 
+* @brief    mcu simple scheduler mutex module header file
+* 
+* @version  0.2.1
+*
+* @author   Leo Hendrawan
+* 
+* @remark   this will be included in compilation only if MSS_TASK_USE_MUTEX
+*           defined as TRUE
+* 
+******************************************************************************/
+
+#ifndef _MSS_MUTEX_H_
+#define _MSS_MUTEX_H_
+
+/**
+ * @ingroup   MSS_API
+ * @defgroup  MSS_Mutex_API  MSS Mutex API
+ * @brief     MSS Mutex module API definitions, data types, and functions
+ *            (enabled only if (MSS_TASK_USE_MUTEX == TRUE))
+ * @{
+ */
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+
+//*****************************************************************************
+// Global variable declarations 
+//*****************************************************************************
+
+
+//*****************************************************************************
+// Macros (defines) and data types 
+//*****************************************************************************
+
+/**
+ * @name MSS Mutex handle
+ * @{
+ */
+
+/** mss_mutex_t
+ *  mss mutex handle data type
+ */
+typedef struct mss_mutex_tbl_t*   mss_mutex_t;
+
+/** MSS_MUTEX_INVALID_HDL
+ *  invalid mutex handle
+ */
+#define MSS_MUTEX_INVALID_HDL     ((mss_mutex_t)NULL)
+
+/** @} MSS Mutex handle */
+
+/**
+ * @name MSS Mutex API Functions
+ * @{
+ */
+
+/** MSS_MUTEX_LOCK
+ *  macro function to lock a mutex, and blocks if the mutex is owned by
+ *  another task
+ */
+#define MSS_MUTEX_LOCK(hdl, context)           \
+        do{while(mss_mutex_lock(hdl) == FALSE) \
+           MSS_RETURN(context);}while(0)
+
+
+//*****************************************************************************
+// External function declarations
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* mss_mutex_create
+*
+* @brief      create a new (unlocked) mutex
+*
+* @param[in]  ceiling    priority ceiling of the mutex, which is the task id
+*                        of the highest priority task locking the mutex
+*
+* @return     handle to created mutex, MSS_MUTEX_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_mutex_t mss_mutex_create(uint8_t ceiling);
+
+/**************************************************************************//**
+*
+* mss_mutex_lock
+*
+* @brief      lock a mutex. The owner task can lock the mutex again
+*             (recursively). While the mutex is locked, the owner task runs
+*             with the ceiling priority of the mutex, so that it can not be
+*             preempted by any other task using the mutex. When the mutex is
+*             owned by another task, the running task will be put into
+*             waiting task list
+*
+* @param[in]  hdl        mutex handle
+*
+* @return     if true mutex is successfully locked, if false mutex is owned
+*             by another task
+*
+* @remark     the mutex can only be owned by another task if the owner task
+*             has returned to the scheduler without unlocking it. The
+*             priority ceiling is not applied while the owner task is not
+*             running
+*
+******************************************************************************/
+bool mss_mutex_lock(mss_mutex_t hdl);
+
+/**************************************************************************//**
+*
+* mss_mutex_unlock
+*
+* @brief      unlock a mutex, shall be called by the owner task as many times
+*             as it has locked the mutex. When the mutex is released, the
+*             ownership is handed over to the waiting task with the highest
+*             priority, which will be activated, and the owner task gets
+*             back its priority without the ceiling of the mutex
+*
+* @param[in]  hdl        mutex handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_mutex_unlock(mss_mutex_t hdl);
+
+/** @} MSS Mutex API Functions */
+
+/** @} MSS_Mutex_API */
+
+#endif /* _MSS_MUTEX_H_*/
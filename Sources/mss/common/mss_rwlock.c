@@ -0,0 +1,349 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     mss_rwlock.c
+* 
+* @brief    mcu simple scheduler reader-writer lock module
+*
+* @version  0.2.1
+*
+* @author   Leo Hendrawan
+* 
+* @remark   this will be included in compilation only if MSS_TASK_USE_RWLOCK
+*           defined as TRUE
+* 
+******************************************************************************/
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+#include "mss.h"
+#include "mss_int.h"
+
+#if (MSS_TASK_USE_RWLOCK == TRUE)
+
+//*****************************************************************************
+// Global variables 
+//*****************************************************************************
+
+//*****************************************************************************
+// Macros (defines), data types, static variables
+//*****************************************************************************
+
+/** mss_rwlock_t
+ *  mss reader-writer lock table data type
+ */
+struct mss_rwlock_tbl_t{
+  uint8_t writer_task;
+  mss_task_bits_t reader_tasks;
+  mss_task_bits_t waiting_readers;
+  mss_task_bits_t waiting_writers;
+};
+
+// number of created reader-writer locks
+static uint8_t num_of_rwlock = 0;
+
+// reader-writer lock table
+static struct mss_rwlock_tbl_t rwlock_tbl[MSS_MAX_NUM_OF_RWLOCK];
+
+//*****************************************************************************
+// Internal function declarations
+//*****************************************************************************
+
+static void rwlock_wakeup_writer(mss_rwlock_t hdl);
+static void rwlock_wakeup_readers(mss_rwlock_t hdl);
+
+//*****************************************************************************
+// External functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* mss_rwlock_create
+*
+* @brief      create a new (unlocked) reader-writer lock
+*
+* @param      -
+*
+* @return     handle to created reader-writer lock, MSS_RWLOCK_INVALID_HDL if
+*             failure
+*
+******************************************************************************/
+mss_rwlock_t mss_rwlock_create(void)
+{
+  mss_rwlock_t ret_hdl = MSS_RWLOCK_INVALID_HDL;
+
+  // check if there is a free reader-writer lock block
+  if(num_of_rwlock < MSS_MAX_NUM_OF_RWLOCK)
+  {
+    // initialize reader-writer lock block as unlocked
+    rwlock_tbl[num_of_rwlock].writer_task = MSS_INVALID_TASK_ID;
+    rwlock_tbl[num_of_rwlock].reader_tasks = 0;
+    rwlock_tbl[num_of_rwlock].waiting_readers = 0;
+    rwlock_tbl[num_of_rwlock].waiting_writers = 0;
+
+    // return handle and increment number of reader-writer lock block
+    ret_hdl = &rwlock_tbl[num_of_rwlock++];
+  }
+
+  return ret_hdl;
+}
+
+/**************************************************************************//**
+*
+* mss_rwlock_rd_lock
+*
+* @brief      lock a reader-writer lock for reading. Many tasks can hold the
+*             lock for reading at the same time, as long as no task holds it
+*             for writing (and, if MSS_RWLOCK_WRITER_PREFERENCE is TRUE, no
+*             writer task is waiting). Otherwise the task will be put into
+*             the waiting reader list
+*
+* @param[in]  hdl        reader-writer lock handle
+*
+* @return     if true the lock is successfully locked for reading, if false
+*             the lock is not available
+*
+******************************************************************************/
+bool mss_rwlock_rd_lock(mss_rwlock_t hdl)
+{
+  bool ret = false;
+  mss_task_bits_t task_bit;
+  mss_int_flag_t int_flag;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_RWLOCK_INVALID_HDL);
+
+  // turn running task id into bit position
+  task_bit = mss_bitpos_to_bit[mss_running_task_id];
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  if((hdl->writer_task == MSS_INVALID_TASK_ID)
+#if (MSS_RWLOCK_WRITER_PREFERENCE == TRUE)
+     && (hdl->waiting_writers == 0)
+#endif /* (MSS_RWLOCK_WRITER_PREFERENCE == TRUE) */
+    )
+  {
+    // add task into the reader list
+    hdl->reader_tasks |= task_bit;
+    ret = true;
+  }
+  else
+  {
+    // lock is not available, put task into waiting reader list
+    hdl->waiting_readers |= task_bit;
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+
+  return ret;
+}
+
+/**************************************************************************//**
+*
+* mss_rwlock_rd_unlock
+*
+* @brief      unlock a reader-writer lock locked for reading. The waiting
+*             writer task with the highest priority will be activated when
+*             the last reader unlocks
+*
+* @param[in]  hdl        reader-writer lock handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_rwlock_rd_unlock(mss_rwlock_t hdl)
+{
+  mss_int_flag_t int_flag;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_RWLOCK_INVALID_HDL);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  // remove task from the reader list
+  hdl->reader_tasks &= ~mss_bitpos_to_bit[mss_running_task_id];
+
+  if(hdl->reader_tasks == 0)
+  {
+    // last reader is gone, a writer can take the lock
+    rwlock_wakeup_writer(hdl);
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+}
+
+/**************************************************************************//**
+*
+* mss_rwlock_wr_lock
+*
+* @brief      lock a reader-writer lock for writing. Only one task can hold
+*             the lock for writing, and only if no task holds it for reading.
+*             Otherwise the task will be put into the waiting writer list
+*
+* @param[in]  hdl        reader-writer lock handle
+*
+* @return     if true the lock is successfully locked for writing, if false
+*             the lock is not available
+*
+******************************************************************************/
+bool mss_rwlock_wr_lock(mss_rwlock_t hdl)
+{
+  bool ret = false;
+  mss_task_bits_t task_bit;
+  mss_int_flag_t int_flag;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_RWLOCK_INVALID_HDL);
+
+  // turn running task id into bit position
+  task_bit = mss_bitpos_to_bit[mss_running_task_id];
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  if((hdl->writer_task == MSS_INVALID_TASK_ID) && (hdl->reader_tasks == 0))
+  {
+    // take the lock, task is no longer waiting
+    hdl->writer_task = mss_running_task_id;
+    hdl->waiting_writers &= ~task_bit;
+    ret = true;
+  }
+  else
+  {
+    // lock is not available, put task into waiting writer list. The task
+    // stays in the list until it gets the lock, so that readers keep out
+    // in between if writer preference is used
+    hdl->waiting_writers |= task_bit;
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+
+  return ret;
+}
+
+/**************************************************************************//**
+*
+* mss_rwlock_wr_unlock
+*
+* @brief      unlock a reader-writer lock locked for writing. Either the
+*             waiting writer task with the highest priority, or all waiting
+*             reader tasks at once will be activated, depending on
+*             MSS_RWLOCK_WRITER_PREFERENCE
+*
+* @param[in]  hdl        reader-writer lock handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_rwlock_wr_unlock(mss_rwlock_t hdl)
+{
+  mss_int_flag_t int_flag;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_RWLOCK_INVALID_HDL);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  // only the writer task can unlock the lock
+  MSS_DEBUG_CHECK(hdl->writer_task == mss_running_task_id);
+
+  // release the lock
+  hdl->writer_task = MSS_INVALID_TASK_ID;
+
+#if (MSS_RWLOCK_WRITER_PREFERENCE == TRUE)
+  if(hdl->waiting_writers)
+  {
+    rwlock_wakeup_writer(hdl);
+  }
+  else
+  {
+    rwlock_wakeup_readers(hdl);
+  }
+#else
+  if(hdl->waiting_readers)
+  {
+    rwlock_wakeup_readers(hdl);
+  }
+  else
+  {
+    rwlock_wakeup_writer(hdl);
+  }
+#endif /* (MSS_RWLOCK_WRITER_PREFERENCE == TRUE) */
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+}
+
+//*****************************************************************************
+// Internal functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* rwlock_wakeup_writer
+*
+* @brief      activate the waiting writer task with the highest priority -
+*             not reentrant
+*
+* @param[in]  hdl        reader-writer lock handle
+*
+* @return     -
+*
+******************************************************************************/
+static void rwlock_wakeup_writer(mss_rwlock_t hdl)
+{
+  if(hdl->waiting_writers)
+  {
+    mss_activate_task_int(mss_get_highest_prio_task(hdl->waiting_writers));
+  }
+}
+
+/**************************************************************************//**
+*
+* rwlock_wakeup_readers
+*
+* @brief      activate all waiting reader tasks at once - not reentrant
+*
+* @param[in]  hdl        reader-writer lock handle
+*
+* @return     -
+*
+******************************************************************************/
+static void rwlock_wakeup_readers(mss_rwlock_t hdl)
+{
+  if(hdl->waiting_readers)
+  {
+    mss_activate_tasks_int(hdl->waiting_readers);
+    hdl->waiting_readers = 0;
+  }
+}
+
+#endif /* (MSS_TASK_USE_RWLOCK == TRUE) */
@@ -0,0 +1,195 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     mss_rwlock.h
+* 
+* @brief    mcu simple scheduler reader-writer lock module header file
+* 
+* @version  0.2.1
+*
+* @author   Leo Hendrawan
+* 
+* @remark   this will be included in compilation only if MSS_TASK_USE_RWLOCK
+*           defined as TRUE
+* 
+******************************************************************************/
+
+#ifndef _MSS_RWLOCK_H_
+#define _MSS_RWLOCK_H_
+
+/**
+ * @ingroup   MSS_API
+ * @defgroup  MSS_Rwlock_API  MSS Reader-Writer Lock API
+ * @brief     MSS Reader-Writer Lock module API definitions, data types, and
+ *            functions (enabled only if (MSS_TASK_USE_RWLOCK == TRUE))
+ * @{
+ */
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+
+//*****************************************************************************
+// Global variable declarations 
+//*****************************************************************************
+
+
+//*****************************************************************************
+// Macros (defines) and data types 
+//*****************************************************************************
+
+/**
+ * @name MSS Reader-Writer Lock handle
+ * @{
+ */
+
+/** mss_rwlock_t
+ *  mss reader-writer lock handle data type
+ */
+typedef struct mss_rwlock_tbl_t*   mss_rwlock_t;
+
+/** MSS_RWLOCK_INVALID_HDL
+ *  invalid reader-writer lock handle
+ */
+#define MSS_RWLOCK_INVALID_HDL    ((mss_rwlock_t)NULL)
+
+/** @} MSS Reader-Writer Lock handle */
+
+/**
+ * @name MSS Reader-Writer Lock API Functions
+ * @{
+ */
+
+/** MSS_RWLOCK_RD_WAIT
+ *  macro function to lock a reader-writer lock for reading, and blocks if
+ *  the lock is not available for readers
+ */
+#define MSS_RWLOCK_RD_WAIT(hdl, context)             \
+        do{while(mss_rwlock_rd_lock(hdl) == FALSE)   \
+           MSS_RETURN(context);}while(0)
+
+/** MSS_RWLOCK_WR_WAIT
+ *  macro function to lock a reader-writer lock for writing, and blocks if
+ *  the lock is not available for a writer
+ */
+#define MSS_RWLOCK_WR_WAIT(hdl, context)             \
+        do{while(mss_rwlock_wr_lock(hdl) == FALSE)   \
+           MSS_RETURN(context);}while(0)
+
+
+//*****************************************************************************
+// External function declarations
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* mss_rwlock_create
+*
+* @brief      create a new (unlocked) reader-writer lock
+*
+* @param      -
+*
+* @return     handle to created reader-writer lock, MSS_RWLOCK_INVALID_HDL if
+*             failure
+*
+******************************************************************************/
+mss_rwlock_t mss_rwlock_create(void);
+
+/**************************************************************************//**
+*
+* mss_rwlock_rd_lock
+*
+* @brief      lock a reader-writer lock for reading. Many tasks can hold the
+*             lock for reading at the same time, as long as no task holds it
+*             for writing (and, if MSS_RWLOCK_WRITER_PREFERENCE is TRUE, no
+*             writer task is waiting). Otherwise the task will be put into
+*             the waiting reader list
+*
+* @param[in]  hdl        reader-writer lock handle
+*
+* @return     if true the lock is successfully locked for reading, if false
+*             the lock is not available
+*
+******************************************************************************/
+bool mss_rwlock_rd_lock(mss_rwlock_t hdl);
+
+/**************************************************************************//**
+*
+* mss_rwlock_rd_unlock
+*
+* @brief      unlock a reader-writer lock locked for reading. The waiting
+*             writer task with the highest priority will be activated when
+*             the last reader unlocks
+*
+* @param[in]  hdl        reader-writer lock handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_rwlock_rd_unlock(mss_rwlock_t hdl);
+
+/**************************************************************************//**
+*
+* mss_rwlock_wr_lock
+*
+* @brief      lock a reader-writer lock for writing. Only one task can hold
+*             the lock for writing, and only if no task holds it for reading.
+*             Otherwise the task will be put into the waiting writer list
+*
+* @param[in]  hdl        reader-writer lock handle
+*
+* @return     if true the lock is successfully locked for writing, if false
+*             the lock is not available
+*
+******************************************************************************/
+bool mss_rwlock_wr_lock(mss_rwlock_t hdl);
+
+/**************************************************************************//**
+*
+* mss_rwlock_wr_unlock
+*
+* @brief      unlock a reader-writer lock locked for writing. Either the
+*             waiting writer task with the highest priority, or all waiting
+*             reader tasks at once will be activated, depending on
+*             MSS_RWLOCK_WRITER_PREFERENCE
+*
+* @param[in]  hdl        reader-writer lock handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_rwlock_wr_unlock(mss_rwlock_t hdl);
+
+/** @} MSS Reader-Writer Lock API Functions */
+
+/** @} MSS_Rwlock_API */
+
+#endif /* _MSS_RWLOCK_H_*/
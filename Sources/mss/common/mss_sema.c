@@ -73,6 +73,21 @@ static uint8_t num_of_sema = 0;
 // semaphore table
 static struct mss_sema_tbl_t sema_tbl[MSS_MAX_NUM_OF_SEMA];
 
+#if (MSS_MAX_NUM_OF_COND > 0)
+/** mss_cond_t
+ *  mss condition variable table data type
+ */
+struct mss_cond_tbl_t{
+  mss_task_bits_t waiting_tasks;
+};
+
+// number of created condition variables
+static uint8_t num_of_cond = 0;
+
+// condition variable table
+static struct mss_cond_tbl_t cond_tbl[MSS_MAX_NUM_OF_COND];
+#endif /* (MSS_MAX_NUM_OF_COND > 0) */
+
 //*****************************************************************************
 // Internal function declarations
 //*****************************************************************************
@@ -220,6 +235,230 @@ void mss_sema_post(mss_sema_t hdl)
   MSS_LEAVE_CRITICAL_SECTION(int_flag);
 }
 
+/**************************************************************************//**
+*
+* mss_sema_wait_abort
+*
+* @brief      remove the running task from the waiting task list of a
+*             semaphore, e.g. when it stops waiting due to a timeout
+*
+* @param[in]  hdl        semaphore handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_sema_wait_abort(mss_sema_t hdl)
+{
+  mss_int_flag_t int_flag;
+
+  // check task id
+  MSS_DEBUG_CHECK(hdl != MSS_SEMA_INVALID_HDL);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  // remove task from waiting task list
+  hdl->waiting_tasks &= ~mss_bitpos_to_bit[mss_running_task_id];
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+}
+
+/**************************************************************************//**
+*
+* mss_sema_post_all
+*
+* @brief      increment (unlock/up) a semaphore like mss_sema_post, but
+*             activate all waiting tasks at once instead of only the one
+*             with the highest priority. The semaphore value is incremented
+*             only once, so the activated tasks compete for the available
+*             units and the losers wait again. To let every waiting task
+*             proceed use mss_cond_broadcast
+*
+* @param[in]  hdl        semaphore handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_sema_post_all(mss_sema_t hdl)
+{
+  uint16_t task_bit;
+  mss_int_flag_t int_flag;
+
+  // check task id
+  MSS_DEBUG_CHECK(hdl != MSS_SEMA_INVALID_HDL);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  // turn running task id into bit position
+  task_bit = mss_bitpos_to_bit[mss_running_task_id];
+
+  // check if task has locked the semaphore before
+  if(hdl->signaling_tasks & task_bit)
+  {
+    // increment the semaphore value
+    hdl->value++;
+
+    // remove task from the signaling list
+    hdl->signaling_tasks &= ~task_bit;
+
+    // activate all waiting tasks and empty the waiting task list
+    if(hdl->waiting_tasks)
+    {
+      mss_activate_tasks_int(hdl->waiting_tasks);
+      hdl->waiting_tasks = 0;
+    }
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+}
+
+#if (MSS_MAX_NUM_OF_COND > 0)
+/**************************************************************************//**
+*
+* mss_cond_create
+*
+* @brief      create a new condition variable
+*
+* @param      -
+*
+* @return     handle to created condition variable, MSS_COND_INVALID_HDL if
+*             failure
+*
+******************************************************************************/
+mss_cond_t mss_cond_create(void)
+{
+  mss_cond_t ret_hdl = MSS_COND_INVALID_HDL;
+
+  // check if there is a free condition variable block
+  if(num_of_cond < MSS_MAX_NUM_OF_COND)
+  {
+    cond_tbl[num_of_cond].waiting_tasks = 0;
+
+    // return handle and increment number of condition variable block
+    ret_hdl = &cond_tbl[num_of_cond++];
+  }
+
+  return ret_hdl;
+}
+
+/**************************************************************************//**
+*
+* mss_cond_wait
+*
+* @brief      put the running task into the waiting task list of a condition
+*             variable. The task shall give up the CPU afterwards (see
+*             MSS_COND_WAIT)
+*
+* @param[in]  hdl        condition variable handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_cond_wait(mss_cond_t hdl)
+{
+  mss_int_flag_t int_flag;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_COND_INVALID_HDL);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  hdl->waiting_tasks |= mss_bitpos_to_bit[mss_running_task_id];
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+}
+
+/**************************************************************************//**
+*
+* mss_cond_wait_abort
+*
+* @brief      remove the running task from the waiting task list of a
+*             condition variable
+*
+* @param[in]  hdl        condition variable handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_cond_wait_abort(mss_cond_t hdl)
+{
+  mss_int_flag_t int_flag;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_COND_INVALID_HDL);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  hdl->waiting_tasks &= ~mss_bitpos_to_bit[mss_running_task_id];
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+}
+
+/**************************************************************************//**
+*
+* mss_cond_signal
+*
+* @brief      activate the waiting task with the highest priority of a
+*             condition variable
+*
+* @param[in]  hdl        condition variable handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_cond_signal(mss_cond_t hdl)
+{
+  uint8_t waiting_task_id;
+  mss_int_flag_t int_flag;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_COND_INVALID_HDL);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  if(hdl->waiting_tasks)
+  {
+    // activate the waiting task with highest priority
+    waiting_task_id = mss_get_highest_prio_task(hdl->waiting_tasks);
+    mss_activate_task_int(waiting_task_id);
+
+    // remove task from waiting task list
+    hdl->waiting_tasks &= ~mss_bitpos_to_bit[waiting_task_id];
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+}
+
+/**************************************************************************//**
+*
+* mss_cond_broadcast
+*
+* @brief      activate all waiting tasks of a condition variable at once
+*
+* @param[in]  hdl        condition variable handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_cond_broadcast(mss_cond_t hdl)
+{
+  mss_int_flag_t int_flag;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_COND_INVALID_HDL);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  if(hdl->waiting_tasks)
+  {
+    // activate all waiting tasks and empty the waiting task list
+    mss_activate_tasks_int(hdl->waiting_tasks);
+    hdl->waiting_tasks = 0;
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+}
+#endif /* (MSS_MAX_NUM_OF_COND > 0) */
+
 //*****************************************************************************
 // Internal functions
 //*****************************************************************************
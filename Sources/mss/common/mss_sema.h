@@ -83,6 +83,25 @@ typedef struct mss_sema_tbl_t*   mss_sema_t;
 
 /** @} MSS Semaphore handle */
 
+#if (MSS_MAX_NUM_OF_COND > 0)
+/**
+ * @name MSS Condition Variable handle
+ * @{
+ */
+
+/** mss_cond_t
+ *  mss condition variable handle data type
+ */
+typedef struct mss_cond_tbl_t*   mss_cond_t;
+
+/** MSS_COND_INVALID_HDL
+ *  invalid condition variable handle
+ */
+#define MSS_COND_INVALID_HDL      ((mss_cond_t)NULL)
+
+/** @} MSS Condition Variable handle */
+#endif /* (MSS_MAX_NUM_OF_COND > 0) */
+
 /**
  * @name MSS Semaphore API Functions
  * @{
@@ -96,6 +115,43 @@ typedef struct mss_sema_tbl_t*   mss_sema_t;
         do{while(mss_sema_wait(hdl) == FALSE) \
            MSS_RETURN(context);}while(0)
 
+#if (MSS_TASK_USE_TIMEOUT == TRUE)
+/** MSS_SEMA_WAIT_TIMEOUT
+ *  macro function to wait for a semaphore for a maximum number of timer ticks
+ *  (shall be greater than zero). result is set to true if the semaphore is
+ *  locked, or false if the timeout expires. An invalid tick value times out
+ *  immediately if the semaphore is not available
+ */
+#define MSS_SEMA_WAIT_TIMEOUT(hdl, result, tick, context)  \
+        do{mss_timeout_start(tick);                        \
+           while((result = mss_sema_wait(hdl)) == FALSE)   \
+           {                                               \
+             if(mss_timeout_check_expired())               \
+             {                                             \
+               mss_sema_wait_abort(hdl);                   \
+               break;                                      \
+             }                                             \
+             MSS_RETURN(context);                          \
+           }                                               \
+           mss_timeout_stop();}while(0)
+#endif /* (MSS_TASK_USE_TIMEOUT == TRUE) */
+
+#if (MSS_MAX_NUM_OF_COND > 0)
+/** MSS_COND_WAIT
+ *  macro function to wait until the condition expression cond becomes true.
+ *  The task is put into the waiting task list of the condition variable
+ *  before cond is evaluated, so a signal can not get lost in between
+ */
+#define MSS_COND_WAIT(hdl, cond, context)  \
+        do{mss_cond_wait(hdl);             \
+           while(!(cond))                  \
+           {                               \
+             MSS_RETURN(context);          \
+             mss_cond_wait(hdl);           \
+           }                               \
+           mss_cond_wait_abort(hdl);}while(0)
+#endif /* (MSS_MAX_NUM_OF_COND > 0) */
+
 
 //*****************************************************************************
 // External function declarations
@@ -145,6 +201,110 @@ bool mss_sema_wait(mss_sema_t hdl);
 ******************************************************************************/
 void mss_sema_post(mss_sema_t hdl);
 
+/**************************************************************************//**
+*
+* mss_sema_wait_abort
+*
+* @brief      remove the running task from the waiting task list of a
+*             semaphore, e.g. when it stops waiting due to a timeout
+*
+* @param[in]  hdl        semaphore handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_sema_wait_abort(mss_sema_t hdl);
+
+/**************************************************************************//**
+*
+* mss_sema_post_all
+*
+* @brief      increment (unlock/up) a semaphore like mss_sema_post, but
+*             activate all waiting tasks at once instead of only the one
+*             with the highest priority. The semaphore value is incremented
+*             only once, so the activated tasks compete for the available
+*             units and the losers wait again. To let every waiting task
+*             proceed use mss_cond_broadcast
+*
+* @param[in]  hdl        semaphore handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_sema_post_all(mss_sema_t hdl);
+
+#if (MSS_MAX_NUM_OF_COND > 0)
+/**************************************************************************//**
+*
+* mss_cond_create
+*
+* @brief      create a new condition variable
+*
+* @param      -
+*
+* @return     handle to created condition variable, MSS_COND_INVALID_HDL if
+*             failure
+*
+******************************************************************************/
+mss_cond_t mss_cond_create(void);
+
+/**************************************************************************//**
+*
+* mss_cond_wait
+*
+* @brief      put the running task into the waiting task list of a condition
+*             variable. The task shall give up the CPU afterwards (see
+*             MSS_COND_WAIT)
+*
+* @param[in]  hdl        condition variable handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_cond_wait(mss_cond_t hdl);
+
+/**************************************************************************//**
+*
+* mss_cond_wait_abort
+*
+* @brief      remove the running task from the waiting task list of a
+*             condition variable
+*
+* @param[in]  hdl        condition variable handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_cond_wait_abort(mss_cond_t hdl);
+
+/**************************************************************************//**
+*
+* mss_cond_signal
+*
+* @brief      activate the waiting task with the highest priority of a
+*             condition variable
+*
+* @param[in]  hdl        condition variable handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_cond_signal(mss_cond_t hdl);
+
+/**************************************************************************//**
+*
+* mss_cond_broadcast
+*
+* @brief      activate all waiting tasks of a condition variable at once
+*
+* @param[in]  hdl        condition variable handle
+*
+* @return     -
+*
+******************************************************************************/
+void mss_cond_broadcast(mss_cond_t hdl);
+#endif /* (MSS_MAX_NUM_OF_COND > 0) */
+
 /** @} MSS Semaphore API Functions */
 
 /** @} MSS_Sema_API */
@@ -0,0 +1,436 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     mss_stream.c
+* 
+* @brief    mcu simple scheduler byte stream module
+*
+* @version  0.2.1
+*
+* @author   Leo Hendrawan
+* 
+* @remark   this will be included in compilation only if MSS_TASK_USE_STREAM
+*           defined as TRUE
+* 
+******************************************************************************/
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+#include "mss.h"
+#include "mss_int.h"
+
+#if (MSS_TASK_USE_STREAM == TRUE)
+
+//*****************************************************************************
+// Global variables 
+//*****************************************************************************
+
+//*****************************************************************************
+// Macros (defines), data types, static variables
+//*****************************************************************************
+
+/** mss_stream_tbl_t
+ *  mss byte stream table data type. The write index is only changed by the
+ *  writer and the read index only by the reader, so both sides can work
+ *  without critical section
+ */
+struct mss_stream_tbl_t{
+  uint8_t *buf;
+  uint16_t size;
+  volatile uint16_t wr_idx;
+  volatile uint16_t rd_idx;
+  uint16_t trigger_level;
+  uint8_t reader_task;
+#if (MSS_TASK_USE_TIMEOUT == TRUE)
+  mss_timer_tick_t idle_tick;
+  uint16_t idle_wr_idx;
+  bool idle_started;
+#endif /* (MSS_TASK_USE_TIMEOUT == TRUE) */
+};
+
+// number of created streams
+static uint8_t num_of_stream = 0;
+
+// stream table
+static struct mss_stream_tbl_t stream_tbl[MSS_MAX_NUM_OF_STREAM];
+
+//*****************************************************************************
+// Internal function declarations
+//*****************************************************************************
+
+static uint16_t stream_count(uint16_t wr_idx, uint16_t rd_idx, uint16_t size);
+
+//*****************************************************************************
+// External functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* mss_stream_create
+*
+* @brief      create a new single producer single consumer byte stream
+*
+* @param[in]  reader_task_id   task id of the task reading the stream
+* @param[in]  size             size of the stream buffer in bytes, the stream
+*                              can hold (size - 1) bytes
+* @param[in]  trigger_level    number of bytes in the stream which activates
+*                              the reader task
+*
+* @return     handle to created stream, MSS_STREAM_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_stream_t mss_stream_create(uint8_t reader_task_id, uint16_t size,
+                               uint16_t trigger_level)
+{
+  mss_stream_t ret_hdl = MSS_STREAM_INVALID_HDL;
+  uint8_t *buf;
+
+  // check if there is a free stream block
+  if(num_of_stream < MSS_MAX_NUM_OF_STREAM)
+  {
+    // try to allocate the stream buffer dynamically
+    buf = MSS_MALLOC(size);
+    MSS_DEBUG_CHECK(buf != NULL);
+
+    if(buf != NULL)
+    {
+      ret_hdl = mss_stream_create_static(buf, reader_task_id, size,
+                                         trigger_level);
+    }
+  }
+
+  return ret_hdl;
+}
+
+/**************************************************************************//**
+*
+* mss_stream_create_static
+*
+* @brief      create a new single producer single consumer byte stream like
+*             mss_stream_create in a stream buffer given by the caller
+*
+* @param[in]  buf              pointer to the stream buffer of size bytes
+*                              (see MSS_STREAM_BUF_DEFINE)
+* @param[in]  reader_task_id   task id of the task reading the stream
+* @param[in]  size             size of the stream buffer in bytes, the stream
+*                              can hold (size - 1) bytes
+* @param[in]  trigger_level    number of bytes in the stream which activates
+*                              the reader task
+*
+* @return     handle to created stream, MSS_STREAM_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_stream_t mss_stream_create_static(void* buf, uint8_t reader_task_id,
+                                      uint16_t size, uint16_t trigger_level)
+{
+  mss_stream_t ret_hdl = MSS_STREAM_INVALID_HDL;
+
+  // check parameters
+  MSS_DEBUG_CHECK((buf != NULL) && (reader_task_id < MSS_NUM_OF_TASKS) &&
+                  (size > 1) && (trigger_level > 0) && (trigger_level < size));
+
+  // check if there is a free stream block
+  if(num_of_stream < MSS_MAX_NUM_OF_STREAM)
+  {
+    stream_tbl[num_of_stream].buf = (uint8_t*)buf;
+    stream_tbl[num_of_stream].size = size;
+    stream_tbl[num_of_stream].wr_idx = 0;
+    stream_tbl[num_of_stream].rd_idx = 0;
+    stream_tbl[num_of_stream].trigger_level = trigger_level;
+    stream_tbl[num_of_stream].reader_task = reader_task_id;
+  #if (MSS_TASK_USE_TIMEOUT == TRUE)
+    stream_tbl[num_of_stream].idle_tick = 0;
+    stream_tbl[num_of_stream].idle_wr_idx = 0;
+    stream_tbl[num_of_stream].idle_started = false;
+  #endif /* (MSS_TASK_USE_TIMEOUT == TRUE) */
+
+    // return valid handle and increment number of stream block
+    ret_hdl = &stream_tbl[num_of_stream++];
+  }
+
+  return ret_hdl;
+}
+
+#if (MSS_TASK_USE_TIMEOUT == TRUE)
+/**************************************************************************//**
+*
+* mss_stream_set_idle_timeout
+*
+* @brief      set the idle timeout of a stream. If bytes below the trigger
+*             level are stored in the stream and no new byte is written
+*             within the idle timeout, the reader task is activated as well
+*
+* @param[in]  hdl     stream handle
+* @param[in]  tick    idle timeout in timer ticks, zero to disable
+*
+* @return     -
+*
+* @remark     the timeout is measured by the reader task, so the idle time
+*             before the reader gets the bytes is between one and two times
+*             the idle timeout
+*
+******************************************************************************/
+void mss_stream_set_idle_timeout(mss_stream_t hdl, mss_timer_tick_t tick)
+{
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_STREAM_INVALID_HDL);
+
+  hdl->idle_tick = tick;
+}
+#endif /* (MSS_TASK_USE_TIMEOUT == TRUE) */
+
+/**************************************************************************//**
+*
+* mss_stream_write
+*
+* @brief      copy bytes into a stream and activate the reader task when the
+*             trigger level is reached
+*
+* @param[in]  hdl     stream handle
+* @param[in]  data    pointer to the bytes to be written
+* @param[in]  len     number of bytes to be written
+*
+* @return     number of bytes written, less than len if the stream is full
+*
+* @remark     can be called from an ISR. The stream buffer is not protected
+*             by a critical section, therefore there shall be only one
+*             writer of a stream. The reader task is activated by
+*             mss_activate_task_from_isr if MSS_ISR_FAST_PATH is TRUE
+*
+******************************************************************************/
+uint16_t mss_stream_write(mss_stream_t hdl, const uint8_t* data, uint16_t len)
+{
+  uint16_t wr_idx, old_count, written = 0;
+  bool activate;
+
+  // check parameters
+  MSS_DEBUG_CHECK((hdl != MSS_STREAM_INVALID_HDL) && (data != NULL));
+
+  wr_idx = hdl->wr_idx;
+  old_count = stream_count(wr_idx, hdl->rd_idx, hdl->size);
+
+  // copy as many bytes as fit, one byte is always kept free to distinguish
+  // between full and empty stream
+  while((written < len) && ((old_count + written) < (hdl->size - 1)))
+  {
+    hdl->buf[wr_idx] = data[written++];
+    if(++wr_idx >= hdl->size)
+    {
+      wr_idx = 0;
+    }
+  }
+
+  // publish the new bytes to the reader
+  hdl->wr_idx = wr_idx;
+
+  // activate the reader when the trigger level is crossed
+  activate = ((old_count < hdl->trigger_level) &&
+              ((old_count + written) >= hdl->trigger_level));
+#if (MSS_TASK_USE_TIMEOUT == TRUE)
+  // the reader needs to start the idle timeout with the first byte
+  activate |= ((hdl->idle_tick > 0) && (old_count == 0) && (written > 0));
+#endif /* (MSS_TASK_USE_TIMEOUT == TRUE) */
+
+  if(activate)
+  {
+  #if (MSS_ISR_FAST_PATH == TRUE)
+    mss_activate_task_from_isr(hdl->reader_task);
+  #else
+    mss_activate_task(hdl->reader_task);
+  #endif /* (MSS_ISR_FAST_PATH == TRUE) */
+  }
+
+  return written;
+}
+
+/**************************************************************************//**
+*
+* mss_stream_get_count
+*
+* @brief      get the number of bytes stored in a stream
+*
+* @param[in]  hdl     stream handle
+*
+* @return     number of bytes stored in the stream
+*
+******************************************************************************/
+uint16_t mss_stream_get_count(mss_stream_t hdl)
+{
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_STREAM_INVALID_HDL);
+
+  return stream_count(hdl->wr_idx, hdl->rd_idx, hdl->size);
+}
+
+/**************************************************************************//**
+*
+* mss_stream_get_span
+*
+* @brief      get the oldest bytes of a stream which are stored contiguously
+*             in the stream buffer, without copying and without removing them
+*
+* @param[in]  hdl     stream handle
+* @param[out] len     number of contiguous bytes
+*
+* @return     pointer to the oldest byte, NULL if the stream is empty
+*
+* @remark     if the stored bytes wrap around the end of the stream buffer,
+*             only the bytes up to the end are returned. After
+*             mss_stream_consume the rest can be get by calling this
+*             function again
+*
+******************************************************************************/
+uint8_t* mss_stream_get_span(mss_stream_t hdl, uint16_t* len)
+{
+  uint16_t wr_idx, rd_idx;
+
+  // check parameters
+  MSS_DEBUG_CHECK((hdl != MSS_STREAM_INVALID_HDL) && (len != NULL));
+
+  wr_idx = hdl->wr_idx;
+  rd_idx = hdl->rd_idx;
+
+  // bytes up to the write index or up to the end of the buffer
+  *len = ((wr_idx >= rd_idx) ? wr_idx : hdl->size) - rd_idx;
+
+  return ((*len == 0) ? NULL : &hdl->buf[rd_idx]);
+}
+
+/**************************************************************************//**
+*
+* mss_stream_consume
+*
+* @brief      remove the oldest bytes of a stream after they have been used
+*
+* @param[in]  hdl     stream handle
+* @param[in]  len     number of bytes to be removed
+*
+* @return     -
+*
+******************************************************************************/
+void mss_stream_consume(mss_stream_t hdl, uint16_t len)
+{
+  uint16_t rd_idx;
+
+  // check parameters
+  MSS_DEBUG_CHECK((hdl != MSS_STREAM_INVALID_HDL) &&
+                  (len <= mss_stream_get_count(hdl)));
+
+  rd_idx = hdl->rd_idx + len;
+  if(rd_idx >= hdl->size)
+  {
+    rd_idx -= hdl->size;
+  }
+
+  // free the bytes for the writer
+  hdl->rd_idx = rd_idx;
+}
+
+/**************************************************************************//**
+*
+* mss_stream_check_ready
+*
+* @brief      check whether the trigger level of a stream is reached or
+*             whether the stream has been idle for the idle timeout
+*
+* @param[in]  hdl     stream handle
+*
+* @return     true if the stream is ready to be read
+*
+* @remark     shall only be called by the reader task
+*
+******************************************************************************/
+bool mss_stream_check_ready(mss_stream_t hdl)
+{
+  uint16_t wr_idx, count;
+  bool ret;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_STREAM_INVALID_HDL);
+
+  wr_idx = hdl->wr_idx;
+  count = stream_count(wr_idx, hdl->rd_idx, hdl->size);
+  ret = (count >= hdl->trigger_level);
+
+#if (MSS_TASK_USE_TIMEOUT == TRUE)
+  if(hdl->idle_tick > 0)
+  {
+    if((ret == true) || (count == 0))
+    {
+      // no idle timeout needed
+      if(hdl->idle_started)
+      {
+        mss_timeout_stop();
+        hdl->idle_started = false;
+      }
+    }
+    else if((hdl->idle_started == false) || (wr_idx != hdl->idle_wr_idx))
+    {
+      // new bytes, (re)start the idle timeout
+      hdl->idle_wr_idx = wr_idx;
+      hdl->idle_started = mss_timeout_start(hdl->idle_tick);
+    }
+    else if(mss_timeout_check_expired())
+    {
+      // no new byte since the idle timeout has been started
+      hdl->idle_started = false;
+      ret = true;
+    }
+  }
+#endif /* (MSS_TASK_USE_TIMEOUT == TRUE) */
+
+  return ret;
+}
+
+//*****************************************************************************
+// Internal functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* stream_count
+*
+* @brief      calculate the number of bytes stored in a stream buffer
+*
+* @param[in]  wr_idx    write index
+* @param[in]  rd_idx    read index
+* @param[in]  size      size of the stream buffer
+*
+* @return     number of bytes stored
+*
+******************************************************************************/
+static uint16_t stream_count(uint16_t wr_idx, uint16_t rd_idx, uint16_t size)
+{
+  return ((wr_idx >= rd_idx) ? (wr_idx - rd_idx) : (wr_idx + size - rd_idx));
+}
+
+#endif /* (MSS_TASK_USE_STREAM == TRUE) */
@@ -0,0 +1,268 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     mss_stream.h
+* 
+* @brief    mcu simple scheduler byte stream module header file
+* 
+* @version  0.2.1
+*
+* @author   Leo Hendrawan
+* 
+* @remark   this will be included in compilation only if MSS_TASK_USE_STREAM
+*           defined as TRUE
+* 
+******************************************************************************/
+
+#ifndef _MSS_STREAM_H_
+#define _MSS_STREAM_H_
+
+/**
+ * @ingroup   MSS_API
+ * @defgroup  MSS_Stream_API  MSS Stream API
+ * @brief     MSS byte stream module API definitions, data types, and
+ *            functions (enabled only if (MSS_TASK_USE_STREAM == TRUE))
+ * @{
+ */
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+
+//*****************************************************************************
+// Global variable declarations 
+//*****************************************************************************
+
+
+//*****************************************************************************
+// Macros (defines) and data types 
+//*****************************************************************************
+
+/**
+ * @name MSS Stream handle
+ * @{
+ */
+
+/** mss_stream_t
+ *  mss byte stream handle data type
+ */
+typedef struct mss_stream_tbl_t*   mss_stream_t;
+
+/** MSS_STREAM_INVALID_HDL
+ *  invalid byte stream handle
+ */
+#define MSS_STREAM_INVALID_HDL     ((mss_stream_t)NULL)
+
+/** MSS_STREAM_BUF_DEFINE
+ *  define the stream buffer for mss_stream_create_static at compile time
+ */
+#define MSS_STREAM_BUF_DEFINE(name, size)                                  \
+        static uint8_t name[size]
+
+/** @} MSS Stream handle */
+
+//*****************************************************************************
+// External function declarations
+//*****************************************************************************
+
+/**
+ * @name MSS Stream API Functions
+ * @{
+ */
+
+/**************************************************************************//**
+*
+* mss_stream_create
+*
+* @brief      create a new single producer single consumer byte stream
+*
+* @param[in]  reader_task_id   task id of the task reading the stream
+* @param[in]  size             size of the stream buffer in bytes, the stream
+*                              can hold (size - 1) bytes
+* @param[in]  trigger_level    number of bytes in the stream which activates
+*                              the reader task
+*
+* @return     handle to created stream, MSS_STREAM_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_stream_t mss_stream_create(uint8_t reader_task_id, uint16_t size,
+                               uint16_t trigger_level);
+
+/**************************************************************************//**
+*
+* mss_stream_create_static
+*
+* @brief      create a new single producer single consumer byte stream like
+*             mss_stream_create in a stream buffer given by the caller
+*
+* @param[in]  buf              pointer to the stream buffer of size bytes
+*                              (see MSS_STREAM_BUF_DEFINE)
+* @param[in]  reader_task_id   task id of the task reading the stream
+* @param[in]  size             size of the stream buffer in bytes, the stream
+*                              can hold (size - 1) bytes
+* @param[in]  trigger_level    number of bytes in the stream which activates
+*                              the reader task
+*
+* @return     handle to created stream, MSS_STREAM_INVALID_HDL if failure
+*
+******************************************************************************/
+mss_stream_t mss_stream_create_static(void* buf, uint8_t reader_task_id,
+                                      uint16_t size, uint16_t trigger_level);
+
+#if (MSS_TASK_USE_TIMEOUT == TRUE)
+/**************************************************************************//**
+*
+* mss_stream_set_idle_timeout
+*
+* @brief      set the idle timeout of a stream. If bytes below the trigger
+*             level are stored in the stream and no new byte is written
+*             within the idle timeout, the reader task is activated as well
+*
+* @param[in]  hdl     stream handle
+* @param[in]  tick    idle timeout in timer ticks, zero to disable
+*
+* @return     -
+*
+* @remark     the timeout is measured by the reader task, so the idle time
+*             before the reader gets the bytes is between one and two times
+*             the idle timeout
+*
+******************************************************************************/
+void mss_stream_set_idle_timeout(mss_stream_t hdl, mss_timer_tick_t tick);
+#endif /* (MSS_TASK_USE_TIMEOUT == TRUE) */
+
+/**************************************************************************//**
+*
+* mss_stream_write
+*
+* @brief      copy bytes into a stream and activate the reader task when the
+*             trigger level is reached
+*
+* @param[in]  hdl     stream handle
+* @param[in]  data    pointer to the bytes to be written
+* @param[in]  len     number of bytes to be written
+*
+* @return     number of bytes written, less than len if the stream is full
+*
+* @remark     can be called from an ISR. The stream buffer is not protected
+*             by a critical section, therefore there shall be only one
+*             writer of a stream. The reader task is activated by
+*             mss_activate_task_from_isr if MSS_ISR_FAST_PATH is TRUE
+*
+******************************************************************************/
+uint16_t mss_stream_write(mss_stream_t hdl, const uint8_t* data, uint16_t len);
+
+/**************************************************************************//**
+*
+* mss_stream_get_count
+*
+* @brief      get the number of bytes stored in a stream
+*
+* @param[in]  hdl     stream handle
+*
+* @return     number of bytes stored in the stream
+*
+******************************************************************************/
+uint16_t mss_stream_get_count(mss_stream_t hdl);
+
+/**************************************************************************//**
+*
+* mss_stream_get_span
+*
+* @brief      get the oldest bytes of a stream which are stored contiguously
+*             in the stream buffer, without copying and without removing them
+*
+* @param[in]  hdl     stream handle
+* @param[out] len     number of contiguous bytes
+*
+* @return     pointer to the oldest byte, NULL if the stream is empty
+*
+* @remark     if the stored bytes wrap around the end of the stream buffer,
+*             only the bytes up to the end are returned. After
+*             mss_stream_consume the rest can be get by calling this
+*             function again
+*
+******************************************************************************/
+uint8_t* mss_stream_get_span(mss_stream_t hdl, uint16_t* len);
+
+/**************************************************************************//**
+*
+* mss_stream_consume
+*
+* @brief      remove the oldest bytes of a stream after they have been used
+*
+* @param[in]  hdl     stream handle
+* @param[in]  len     number of bytes to be removed
+*
+* @return     -
+*
+******************************************************************************/
+void mss_stream_consume(mss_stream_t hdl, uint16_t len);
+
+/**************************************************************************//**
+*
+* mss_stream_check_ready
+*
+* @brief      check whether the trigger level of a stream is reached or
+*             whether the stream has been idle for the idle timeout
+*
+* @param[in]  hdl     stream handle
+*
+* @return     true if the stream is ready to be read
+*
+* @remark     shall only be called by the reader task
+*
+******************************************************************************/
+bool mss_stream_check_ready(mss_stream_t hdl);
+
+/**************************************************************************//**
+*
+* MSS_STREAM_WAIT
+*
+* @brief      macro (blocking) function which waits until the trigger level
+*             of a stream is reached or the stream has been idle for the
+*             idle timeout
+*
+* @param[in]  hdl       stream handle
+* @param[in]  context   mss task context
+*
+* @return     -
+*
+******************************************************************************/
+#define MSS_STREAM_WAIT(hdl, context)                 \
+        do{while(!mss_stream_check_ready(hdl))        \
+           MSS_RETURN(context);}while(0)
+
+/** @} MSS Stream API Functions */
+
+/** @} MSS_Stream_API */
+
+#endif /* _MSS_STREAM_H_*/
@@ -73,7 +73,7 @@ struct mss_timer_tbl_t {
 };
 
 // linked list of active timer
-static llist_t active_timer_llist;
+static llist_head_t active_timer_llist;
 
 // mss timer blocks
 static struct mss_timer_tbl_t timer_tbl[MSS_MAX_NUM_OF_TIMER];
@@ -81,6 +81,11 @@ static struct mss_timer_tbl_t timer_tbl[MSS_MAX_NUM_OF_TIMER];
 // number of used mss timer blocks
 static uint8_t num_of_timer = 0;
 
+#if (MSS_TASK_USE_TIMEOUT == TRUE)
+// internal timeout timer blocks, one for every task
+static struct mss_timer_tbl_t timeout_tbl[MSS_NUM_OF_TASKS];
+#endif /* (MSS_TASK_USE_TIMEOUT == TRUE) */
+
 // MSB mask for knowing in which half the timer tick resides
 #define MSB_TMR_MASK  (mss_timer_tick_t) (1UL << ( (sizeof(mss_timer_tick_t)*8) - 1 ))
 
@@ -127,10 +132,20 @@ void mss_timer_init(void)
 	timer_tbl[i].expired_tick = 0;
 	timer_tbl[i].reload_tick = 0;
   }
+
+#if (MSS_TASK_USE_TIMEOUT == TRUE)
+  // initialize timeout timer blocks, each owned by its task
+  for(i=0 ; i<MSS_NUM_OF_TASKS ; i++)
+  {
+    timeout_tbl[i].task_id = i;
+    timeout_tbl[i].state = MSS_TIMER_STATE_IDLE;
+    timeout_tbl[i].expired_tick = 0;
+    timeout_tbl[i].reload_tick = 0;
+  }
+#endif /* (MSS_TASK_USE_TIMEOUT == TRUE) */
   
   // initialize linked list timer
-  active_timer_llist = llist_create();
-  MSS_DEBUG_CHECK(active_timer_llist != LLIST_INVALID_HDL);
+  llist_init(&active_timer_llist);
 }
 
 /**************************************************************************//**
@@ -260,7 +275,7 @@ void mss_timer_stop(mss_timer_t hdl)
   if(hdl->state & TIMER_ALL_RUNNING_MASK)
   {
     // search for the timer and remove it
-    llist_remove(active_timer_llist, hdl);
+    llist_remove(&active_timer_llist, hdl);
 
     // set timer state as idle
     hdl->state = MSS_TIMER_STATE_IDLE;
@@ -342,6 +357,73 @@ bool mss_timer_check_expired(mss_timer_t hdl)
   return ret;
 }
 
+#if (MSS_TASK_USE_TIMEOUT == TRUE)
+/**************************************************************************//**
+*
+* mss_timeout_start
+*
+* @brief      start the internal timeout timer of the running task. The task
+*             will be activated when the timeout expires
+*
+* @param[in]  tick    number of timer ticks until timeout (shall be greater
+*                     than zero, maximum value is half of maximum value of the
+*                     data type size ((sizeof(mss_timer_tick_t)/2)-1) )
+*
+* @return     true if success, false if failed. If failed, the timeout is
+*             marked as expired immediately
+*
+******************************************************************************/
+bool mss_timeout_start(mss_timer_tick_t tick)
+{
+  mss_timer_t hdl = &timeout_tbl[mss_running_task_id];
+  bool ret;
+
+  ret = timer_start(hdl, tick, 0);
+  if(ret == false)
+  {
+    // invalid timeout, let the waiting task time out immediately instead
+    // of waiting forever
+    mss_timer_stop(hdl);
+    hdl->state = MSS_TIMER_STATE_EXPIRED_ONE_SHOT;
+  }
+
+  return ret;
+}
+
+/**************************************************************************//**
+*
+* mss_timeout_check_expired
+*
+* @brief      check whether the internal timeout timer of the running task
+*             has expired
+*
+* @param      -
+*
+* @return     true if timeout has expired, false if not
+*
+******************************************************************************/
+bool mss_timeout_check_expired(void)
+{
+  return (mss_timer_check_expired(&timeout_tbl[mss_running_task_id]));
+}
+
+/**************************************************************************//**
+*
+* mss_timeout_stop
+*
+* @brief      stop the internal timeout timer of the running task
+*
+* @param      -
+*
+* @return     -
+*
+******************************************************************************/
+void mss_timeout_stop(void)
+{
+  mss_timer_stop(&timeout_tbl[mss_running_task_id]);
+}
+#endif /* (MSS_TASK_USE_TIMEOUT == TRUE) */
+
 /**************************************************************************//**
 *
 * mss_timer_tick
@@ -401,7 +483,7 @@ bool mss_timer_tick(void)
       loop = false;
 
       // check for expired timer
-      youngest_tmr = llist_touch_first(active_timer_llist);
+      youngest_tmr = llist_touch_first(&active_timer_llist);
 	  if(youngest_tmr != NULL)
 	  {
 		if(youngest_tmr->expired_tick == timer_tick_cnt)
@@ -415,7 +497,7 @@ bool mss_timer_tick(void)
           youngest_tmr->state <<= 1;
 
           // remove timer object from active timer list
-          llist_get_first(active_timer_llist);
+          llist_get_first(&active_timer_llist);
 
           // if a periodic timer, returns to the active timer list
           if(youngest_tmr->reload_tick > 0)
@@ -424,11 +506,8 @@ bool mss_timer_tick(void)
             youngest_tmr->expired_tick = timer_tick_cnt +
                                          youngest_tmr->reload_tick;
 
-            // put the timer into the active timer linked list
-            llist_add_first(active_timer_llist, youngest_tmr);
-
-            // sort the active timer list
-            llist_sort(active_timer_llist, timer_cmp);
+            // put the timer back into the sorted active timer linked list
+            llist_insert_sorted(&active_timer_llist, youngest_tmr, timer_cmp);
           }
 
           // return true
@@ -475,7 +554,7 @@ mss_timer_tick_t mss_timer_get_next_tick(void)
   MSS_ENTER_CRITICAL_SECTION(int_flag);
 
   // check for expired timer
-  youngest_tmr = llist_touch_first(active_timer_llist);
+  youngest_tmr = llist_touch_first(&active_timer_llist);
   if(youngest_tmr != NULL)
   {
     ret = youngest_tmr->expired_tick - mss_timer_tick_cnt;
@@ -524,19 +603,19 @@ static bool timer_start(mss_timer_t hdl, mss_timer_tick_t tick,
     hdl->expired_tick = mss_timer_tick_cnt + tick;
     hdl->reload_tick = reload;
 
-    if(!(hdl->state & TIMER_ALL_RUNNING_MASK))
+    if(hdl->state & TIMER_ALL_RUNNING_MASK)
     {
-      // put the timer into the active timer linked list
-      llist_add_first(active_timer_llist, hdl);
+      // restarted timer, remove it from its old position
+      llist_remove(&active_timer_llist, hdl);
     }
 
+    // put the timer into the sorted active timer linked list
+    llist_insert_sorted(&active_timer_llist, hdl, timer_cmp);
+
     // set new state
     hdl->state = (reload > 0) ? MSS_TIMER_STATE_RUNNING_PERIODIC :
   		                      MSS_TIMER_STATE_RUNNING_ONE_SHOT;
 
-    // sort the active timer list
-    llist_sort(active_timer_llist, timer_cmp);
-
     // return true
     ret = true;
 
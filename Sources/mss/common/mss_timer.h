@@ -260,6 +260,52 @@ mss_timer_state_t mss_timer_get_state(mss_timer_t hdl);
 ******************************************************************************/
 bool mss_timer_check_expired(mss_timer_t hdl);
 
+#if (MSS_TASK_USE_TIMEOUT == TRUE)
+/**************************************************************************//**
+*
+* mss_timeout_start
+*
+* @brief      start the internal timeout timer of the running task. The task
+*             will be activated when the timeout expires
+*
+* @param[in]  tick    number of timer ticks until timeout (shall be greater
+*                     than zero, maximum value is half of maximum value of the
+*                     data type size ((sizeof(mss_timer_tick_t)/2)-1) )
+*
+* @return     true if success, false if failed. If failed, the timeout is
+*             marked as expired immediately
+*
+******************************************************************************/
+bool mss_timeout_start(mss_timer_tick_t tick);
+
+/**************************************************************************//**
+*
+* mss_timeout_check_expired
+*
+* @brief      check whether the internal timeout timer of the running task
+*             has expired
+*
+* @param      -
+*
+* @return     true if timeout has expired, false if not
+*
+******************************************************************************/
+bool mss_timeout_check_expired(void);
+
+/**************************************************************************//**
+*
+* mss_timeout_stop
+*
+* @brief      stop the internal timeout timer of the running task
+*
+* @param      -
+*
+* @return     -
+*
+******************************************************************************/
+void mss_timeout_stop(void);
+#endif /* (MSS_TASK_USE_TIMEOUT == TRUE) */
+
 /**************************************************************************//**
 *
 * MSS_TIMER_MS_TO_TICKS
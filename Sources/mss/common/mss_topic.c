@@ -0,0 +1,380 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     mss_topic.c
+* 
+* @brief    mcu simple scheduler publish/subscribe topic module
+*
+* @version  0.2.1
+*
+* @author   Leo Hendrawan
+* 
+* @remark   this will be included in compilation only if MSS_TASK_USE_TOPIC
+*           defined as TRUE
+* 
+******************************************************************************/
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+#include "mss.h"
+#include "mss_int.h"
+
+#if (MSS_TASK_USE_TOPIC == TRUE)
+
+//*****************************************************************************
+// Global variables 
+//*****************************************************************************
+
+//*****************************************************************************
+// Macros (defines), data types, static variables
+//*****************************************************************************
+
+/** topic_buf_t
+ *  header of a topic message buffer, followed by the message data. The
+ *  message buffer is a reference counted buffer (mss_buf) with one
+ *  reference for every subscriber which has not released the message yet
+ */
+typedef struct {
+  void *next;
+  mss_task_bits_t pending_tasks;
+} topic_buf_t;
+
+/** mss_topic_tbl_t
+ *  mss topic table data type
+ */
+struct mss_topic_tbl_t{
+  mss_mem_t mem;
+  llist_head_t msg_list;
+  mss_task_bits_t subscribers;
+};
+
+// number of created topics
+static uint8_t num_of_topic = 0;
+
+// topic table
+static struct mss_topic_tbl_t topic_tbl[MSS_MAX_NUM_OF_TOPIC];
+
+// convert message data pointer to buffer header and vice versa
+#define TOPIC_DATA_TO_BUF(data)    ((topic_buf_t*)(data) - 1)
+#define TOPIC_BUF_TO_DATA(buf)     ((void*)((topic_buf_t*)(buf) + 1))
+
+//*****************************************************************************
+// Internal function declarations
+//*****************************************************************************
+
+static void topic_mark_read(mss_topic_t hdl, topic_buf_t *buf,
+                            mss_task_bits_t task_bit);
+
+//*****************************************************************************
+// External functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* mss_topic_create
+*
+* @brief      create a new topic together with its own memory block list for
+*             the message buffers
+*
+* @param[in]  data_size       size of a message in bytes
+* @param[in]  num_of_bufs     number of message buffers
+*
+* @return     handle to created topic, MSS_TOPIC_INVALID_HDL if failure
+*
+* @remark     uses one memory block list of the MSS memory module for the
+*             reference counted buffers (mss_buf)
+*
+******************************************************************************/
+mss_topic_t mss_topic_create(uint8_t data_size, uint8_t num_of_bufs)
+{
+  mss_topic_t ret_hdl = MSS_TOPIC_INVALID_HDL;
+
+  // check if there is a free topic block
+  if(num_of_topic < MSS_MAX_NUM_OF_TOPIC)
+  {
+    // create the message buffers
+    topic_tbl[num_of_topic].mem = mss_mem_create(
+                  MSS_BUF_BLOCK_SIZE(sizeof(topic_buf_t) + data_size),
+                  num_of_bufs);
+
+    // the topic is created only with its message buffers
+    if(topic_tbl[num_of_topic].mem != MSS_MEM_INVALID_HDL)
+    {
+      llist_init(&topic_tbl[num_of_topic].msg_list);
+      topic_tbl[num_of_topic].subscribers = 0;
+
+      // return handle and increment number of topic block
+      ret_hdl = &topic_tbl[num_of_topic++];
+    }
+  }
+
+  return ret_hdl;
+}
+
+/**************************************************************************//**
+*
+* mss_topic_subscribe
+*
+* @brief      add a task into the subscriber list of a topic
+*
+* @param[in]  hdl        topic handle
+* @param[in]  task_id    task id number
+*
+* @return     -
+*
+******************************************************************************/
+void mss_topic_subscribe(mss_topic_t hdl, uint8_t task_id)
+{
+  mss_int_flag_t int_flag;
+
+  // check parameters
+  MSS_DEBUG_CHECK((hdl != MSS_TOPIC_INVALID_HDL) &&
+                  (task_id < MSS_NUM_OF_TASKS));
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  hdl->subscribers |= mss_bitpos_to_bit[task_id];
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+}
+
+/**************************************************************************//**
+*
+* mss_topic_unsubscribe
+*
+* @brief      remove a task from the subscriber list of a topic. Messages
+*             which are not yet read by the task are released
+*
+* @param[in]  hdl        topic handle
+* @param[in]  task_id    task id number
+*
+* @return     -
+*
+******************************************************************************/
+void mss_topic_unsubscribe(mss_topic_t hdl, uint8_t task_id)
+{
+  topic_buf_t *buf, *next_buf;
+  mss_int_flag_t int_flag;
+
+  // check parameters
+  MSS_DEBUG_CHECK((hdl != MSS_TOPIC_INVALID_HDL) &&
+                  (task_id < MSS_NUM_OF_TASKS));
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  hdl->subscribers &= ~mss_bitpos_to_bit[task_id];
+
+  // release the messages which are not yet read by the task
+  for(buf = llist_touch_first(&hdl->msg_list) ; buf != NULL ; buf = next_buf)
+  {
+    next_buf = buf->next;
+    if(buf->pending_tasks & mss_bitpos_to_bit[task_id])
+    {
+      topic_mark_read(hdl, buf, mss_bitpos_to_bit[task_id]);
+      mss_buf_unref(buf);
+    }
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+}
+
+/**************************************************************************//**
+*
+* mss_topic_alloc
+*
+* @brief      allocate a message buffer of a topic to be filled and published
+*
+* @param[in]  hdl        topic handle
+*
+* @return     pointer to the message data, NULL if no buffer is available
+*
+******************************************************************************/
+void* mss_topic_alloc(mss_topic_t hdl)
+{
+  topic_buf_t *buf;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_TOPIC_INVALID_HDL);
+
+  buf = mss_buf_alloc(hdl->mem);
+
+  return ((buf == NULL) ? NULL : TOPIC_BUF_TO_DATA(buf));
+}
+
+/**************************************************************************//**
+*
+* mss_topic_publish
+*
+* @brief      publish a message to all subscriber tasks of a topic (will
+*             activate the tasks). The message is not copied, every
+*             subscriber gets a reference to the same buffer, and the buffer
+*             is freed when all subscribers have released it
+*
+* @param[in]  hdl        topic handle
+* @param[in]  data       pointer to the message data from mss_topic_alloc
+*
+* @return     -
+*
+******************************************************************************/
+void mss_topic_publish(mss_topic_t hdl, void* data)
+{
+  topic_buf_t *buf;
+  uint8_t i;
+  mss_int_flag_t int_flag;
+
+  // check parameters
+  MSS_DEBUG_CHECK((hdl != MSS_TOPIC_INVALID_HDL) && (data != NULL));
+
+  buf = TOPIC_DATA_TO_BUF(data);
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  // one reference for every subscriber
+  buf->pending_tasks = hdl->subscribers;
+  for(i=0 ; i<MSS_NUM_OF_TASKS ; i++)
+  {
+    if(hdl->subscribers & mss_bitpos_to_bit[i])
+    {
+      mss_buf_ref(buf);
+    }
+  }
+
+  if(buf->pending_tasks != 0)
+  {
+    // queue the message and wake up all subscribers at once
+    llist_add_last(&hdl->msg_list, buf);
+    mss_activate_tasks_int(hdl->subscribers);
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+
+  // drop the reference of the publisher, frees the buffer if nobody is
+  // interested in the message
+  mss_buf_unref(buf);
+}
+
+/**************************************************************************//**
+*
+* mss_topic_read
+*
+* @brief      get the oldest message of a topic which is not yet read by the
+*             running task. The message shall be released by
+*             mss_topic_release after use
+*
+* @param[in]  hdl        topic handle
+*
+* @return     pointer to the message data, NULL if no message available
+*
+******************************************************************************/
+void* mss_topic_read(mss_topic_t hdl)
+{
+  topic_buf_t *buf;
+  mss_task_bits_t task_bit;
+  mss_int_flag_t int_flag;
+
+  // check handle
+  MSS_DEBUG_CHECK(hdl != MSS_TOPIC_INVALID_HDL);
+
+  task_bit = mss_bitpos_to_bit[mss_running_task_id];
+
+  MSS_ENTER_CRITICAL_SECTION(int_flag);
+
+  // search the oldest message which is not yet read by the running task
+  for(buf = llist_touch_first(&hdl->msg_list) ; buf != NULL ; buf = buf->next)
+  {
+    if(buf->pending_tasks & task_bit)
+    {
+      topic_mark_read(hdl, buf, task_bit);
+      break;
+    }
+  }
+
+  MSS_LEAVE_CRITICAL_SECTION(int_flag);
+
+  return ((buf == NULL) ? NULL : TOPIC_BUF_TO_DATA(buf));
+}
+
+/**************************************************************************//**
+*
+* mss_topic_release
+*
+* @brief      release a reference to a message of a topic. The message
+*             buffer is freed with the last reference
+*
+* @param[in]  hdl        topic handle
+* @param[in]  data       pointer to the message data
+*
+* @return     -
+*
+******************************************************************************/
+void mss_topic_release(mss_topic_t hdl, void* data)
+{
+  // check parameters
+  MSS_DEBUG_CHECK((hdl != MSS_TOPIC_INVALID_HDL) && (data != NULL));
+
+  // the buffer keeps its own reference count, the topic is not needed
+  (void)hdl;
+
+  mss_buf_unref(TOPIC_DATA_TO_BUF(data));
+}
+
+//*****************************************************************************
+// Internal functions
+//*****************************************************************************
+
+/**************************************************************************//**
+*
+* topic_mark_read
+*
+* @brief      mark a message as read by a task, and remove it from the list
+*             of published messages when all subscribers have read it. The
+*             reference of the task is not released - not reentrant
+*
+* @param[in]  hdl        topic handle
+* @param[in]  buf        pointer to the message buffer
+* @param[in]  task_bit   task bit of the task
+*
+* @return     -
+*
+******************************************************************************/
+static void topic_mark_read(mss_topic_t hdl, topic_buf_t *buf,
+                            mss_task_bits_t task_bit)
+{
+  buf->pending_tasks &= ~task_bit;
+
+  if(buf->pending_tasks == 0)
+  {
+    llist_remove(&hdl->msg_list, buf);
+  }
+}
+
+#endif /* (MSS_TASK_USE_TOPIC == TRUE) */
@@ -0,0 +1,223 @@
+/******************************************************************************
+* Copyright (c) 2012-2013, Leo Hendrawan
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*    * Redistributions of source code must retain the above copyright
+*      notice, this list of conditions and the following disclaimer.
+*    * Redistributions in binary form must reproduce the above copyright
+*      notice, this list of conditions and the following disclaimer in the
+*      documentation and/or other materials provided with the distribution.
+*    * Neither the name of the MSS PROJECT nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE MSS PROJECT OR ITS
+* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+/**************************************************************************//**
+* 
+* @file     mss_topic.h
+* 
+* @brief    mcu simple scheduler publish/subscribe topic module header file
+* 
+* @version  0.2.1
+*
+* @author   Leo Hendrawan
+* 
+* @remark   this will be included in compilation only if MSS_TASK_USE_TOPIC
+*           defined as TRUE
+* 
+******************************************************************************/
+
+#ifndef _MSS_TOPIC_H_
+#define _MSS_TOPIC_H_
+
+/**
+ * @ingroup   MSS_API
+ * @defgroup  MSS_Topic_API  MSS Topic API
+ * @brief     MSS publish/subscribe topic module API definitions, data types,
+ *            and functions (enabled only if (MSS_TASK_USE_TOPIC == TRUE))
+ * @{
+ */
+
+//*****************************************************************************
+// Include section
+//*****************************************************************************
+
+
+//*****************************************************************************
+// Global variable declarations 
+//*****************************************************************************
+
+
+//*****************************************************************************
+// Macros (defines) and data types 
+//*****************************************************************************
+
+/**
+ * @name MSS Topic handle
+ * @{
+ */
+
+/** mss_topic_t
+ *  mss topic handle data type
+ */
+typedef struct mss_topic_tbl_t*   mss_topic_t;
+
+/** MSS_TOPIC_INVALID_HDL
+ *  invalid topic handle
+ */
+#define MSS_TOPIC_INVALID_HDL     ((mss_topic_t)NULL)
+
+/** @} MSS Topic handle */
+
+//*****************************************************************************
+// External function declarations
+//*****************************************************************************
+
+/**
+ * @name MSS Topic API Functions
+ * @{
+ */
+
+/**************************************************************************//**
+*
+* mss_topic_create
+*
+* @brief      create a new topic together with its own memory block list for
+*             the message buffers
+*
+* @param[in]  data_size       size of a message in bytes
+* @param[in]  num_of_bufs     number of message buffers
+*
+* @return     handle to created topic, MSS_TOPIC_INVALID_HDL if failure
+*
+* @remark     uses one memory block list of the MSS memory module
+*
+******************************************************************************/
+mss_topic_t mss_topic_create(uint8_t data_size, uint8_t num_of_bufs);
+
+/**************************************************************************//**
+*
+* mss_topic_subscribe
+*
+* @brief      add a task into the subscriber list of a topic
+*
+* @param[in]  hdl        topic handle
+* @param[in]  task_id    task id number
+*
+* @return     -
+*
+******************************************************************************/
+void mss_topic_subscribe(mss_topic_t hdl, uint8_t task_id);
+
+/**************************************************************************//**
+*
+* mss_topic_unsubscribe
+*
+* @brief      remove a task from the subscriber list of a topic. Messages
+*             which are not yet read by the task are released
+*
+* @param[in]  hdl        topic handle
+* @param[in]  task_id    task id number
+*
+* @return     -
+*
+******************************************************************************/
+void mss_topic_unsubscribe(mss_topic_t hdl, uint8_t task_id);
+
+/**************************************************************************//**
+*
+* mss_topic_alloc
+*
+* @brief      allocate a message buffer of a topic to be filled and published
+*
+* @param[in]  hdl        topic handle
+*
+* @return     pointer to the message data, NULL if no buffer is available
+*
+******************************************************************************/
+void* mss_topic_alloc(mss_topic_t hdl);
+
+/**************************************************************************//**
+*
+* mss_topic_publish
+*
+* @brief      publish a message to all subscriber tasks of a topic (will
+*             activate the tasks). The message is not copied, every
+*             subscriber gets a reference to the same buffer, and the buffer
+*             is freed when all subscribers have released it
+*
+* @param[in]  hdl        topic handle
+* @param[in]  data       pointer to the message data from mss_topic_alloc
+*
+* @return     -
+*
+******************************************************************************/
+void mss_topic_publish(mss_topic_t hdl, void* data);
+
+/**************************************************************************//**
+*
+* mss_topic_read
+*
+* @brief      get the oldest message of a topic which is not yet read by the
+*             running task. The message shall be released by
+*             mss_topic_release after use
+*
+* @param[in]  hdl        topic handle
+*
+* @return     pointer to the message data, NULL if no message available
+*
+******************************************************************************/
+void* mss_topic_read(mss_topic_t hdl);
+
+/**************************************************************************//**
+*
+* mss_topic_release
+*
+* @brief      release a reference to a message of a topic. The message
+*             buffer is freed with the last reference
+*
+* @param[in]  hdl        topic handle
+* @param[in]  data       pointer to the message data
+*
+* @return     -
+*
+******************************************************************************/
+void mss_topic_release(mss_topic_t hdl, void* data);
+
+/**************************************************************************//**
+*
+* MSS_TOPIC_WAIT
+*
+* @brief      macro (blocking) function which waits until a message which is
+*             not yet read by the running task is published to a topic
+*
+* @param[in]  hdl       topic handle
+* @param[out] data      buffer for storing the pointer to the message data
+* @param[in]  context   mss task context
+*
+* @return     -
+*
+******************************************************************************/
+#define MSS_TOPIC_WAIT(hdl, data, context)               \
+        do{while((data = mss_topic_read(hdl)) == NULL)   \
+           MSS_RETURN(context);}while(0)
+
+/** @} MSS Topic API Functions */
+
+/** @} MSS_Topic_API */
+
+#endif /* _MSS_TOPIC_H_*/
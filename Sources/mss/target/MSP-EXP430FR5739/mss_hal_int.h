@@ -62,6 +62,16 @@
  */
 #define MSS_ENABLE_GLOBAL_INTERRUPT()       __enable_interrupt()
 
+#if (MSS_ISR_FAST_PATH == TRUE)
+/** MSS_ATOMIC_OR
+ *  set bits in a variable with a read-modify-write operation which can not
+ *  be interrupted. On MSP430 this is compiled into a single BIS instruction
+ *  with memory destination. A 32 bit variable takes two BIS instructions,
+ *  which is still safe since every half is only OR-ed.
+ */
+#define MSS_ATOMIC_OR(var, bits)            ((var) |= (bits))
+#endif /* (MSS_ISR_FAST_PATH == TRUE) */
+
 
 //*****************************************************************************
 // External function declarations
@@ -57,18 +57,13 @@
 //*****************************************************************************
 
 /** MAX_NUM_OF_LLIST
- *  maximum number of linked list. MSS needs at least:
- *   - one linked list if MSS timer module is activated (MSS_TASK_USE_TIMER==TRUE)
- *   - one for every message queues 
- *   - one for every memory blocks
- *  The application might increase the number of linked list if it wish to
- *  use the linked list (llist) module.
+ *  maximum number of linked list which can be created with llist_create.
+ *  MSS modules embed their linked lists and do not need any of them, the
+ *  application might increase the number of linked list if it wish to
+ *  use llist_create. Linked lists can also be embedded by the application
+ *  with llist_head_t and llist_init without this table.
  */
-#if (MSS_TASK_USE_TIMER == TRUE)
-#define MAX_NUM_OF_LLIST         (1 + MSS_MAX_NUM_OF_MQUE + MSS_MAX_NUM_OF_MEM)
-#else
-#define MAX_NUM_OF_LLIST         (MSS_MAX_NUM_OF_MQUE + MSS_MAX_NUM_OF_MEM)
-#endif
+#define MAX_NUM_OF_LLIST         (0)
 
 /** LLIST_DEBUG_MODE
  *  activate the debug mode of linked list (llist) module if TRUE. Can be
@@ -76,6 +71,12 @@
  */
 #define LLIST_DEBUG_MODE         (FALSE)
 
+/** LLIST_USE_COUNT
+ *  keep the number of objects of every linked list, so that llist_count
+ *  works in constant time. Costs two bytes per linked list.
+ */
+#define LLIST_USE_COUNT          (FALSE)
+
 //*****************************************************************************
 // External function declarations
 //*****************************************************************************
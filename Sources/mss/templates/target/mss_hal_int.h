@@ -62,6 +62,14 @@
  */
 #define MSS_ENABLE_GLOBAL_INTERRUPT()       
 
+#if (MSS_ISR_FAST_PATH == TRUE)
+/** MSS_ATOMIC_OR
+ *  set bits in a variable with a read-modify-write operation which can not
+ *  be interrupted. Needed only if @ref MSS_ISR_FAST_PATH is set to TRUE.
+ */
+#define MSS_ATOMIC_OR(var, bits)
+#endif /* (MSS_ISR_FAST_PATH == TRUE) */
+
 //*****************************************************************************
 // External function declarations
 //*****************************************************************************